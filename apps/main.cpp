@@ -12,6 +12,36 @@
 #include <print>
 #include <string>
 
+namespace {
+
+/// Run one case in the given precision mode and write its output files
+template <typename T, typename Acc>
+void run_case(const euler1d::Config& config, const std::filesystem::path& output_dir) {
+    // Create and run solver
+    euler1d::BasicSolver<T, Acc> solver(config);
+    solver.set_output_dir(output_dir);
+    solver.set_verbose(true);
+    solver.run();
+
+    // Get solution
+    const auto& U = solver.solution();
+    const auto W = solver.to_primitive();
+    const auto& mesh = solver.mesh();
+
+    // Write output files
+    const std::string base_name = config.simulation.test_name;
+
+    const auto csv_path = output_dir / (base_name + ".csv");
+    euler1d::write_csv(csv_path, mesh, U, W, solver.time());
+    std::println("Wrote CSV: {}", csv_path.string());
+
+    const auto vtk_path = output_dir / (base_name + ".vtk");
+    euler1d::write_vtk(vtk_path, mesh, U, W, solver.time());
+    std::println("Wrote VTK: {}", vtk_path.string());
+}
+
+}  // namespace
+
 void print_usage(const char* program) {
     std::println("Usage: {} <config.toml> [output_dir]", program);
     std::println("");
@@ -37,25 +67,11 @@ int main(int argc, char* argv[]) {
         std::println("Loading configuration: {}", config_path.string());
         const auto config = euler1d::parse_config(config_path);
 
-        // Create and run solver
-        euler1d::Solver solver(config);
-        solver.run();
-
-        // Get solution
-        const auto& U = solver.solution();
-        const auto W = solver.to_primitive();
-        const auto& mesh = solver.mesh();
-
-        // Write output files
-        const std::string base_name = config.simulation.test_name;
-
-        const auto csv_path = output_dir / (base_name + ".csv");
-        euler1d::write_csv(csv_path, mesh, U, W, solver.time());
-        std::println("Wrote CSV: {}", csv_path.string());
-
-        const auto vtk_path = output_dir / (base_name + ".vtk");
-        euler1d::write_vtk(vtk_path, mesh, U, W, solver.time());
-        std::println("Wrote VTK: {}", vtk_path.string());
+        switch (config.execution.precision) {
+            case euler1d::Precision::Double: run_case<double, double>(config, output_dir); break;
+            case euler1d::Precision::Float: run_case<float, float>(config, output_dir); break;
+            case euler1d::Precision::Mixed: run_case<float, double>(config, output_dir); break;
+        }
 
         return 0;
 
@@ -0,0 +1,80 @@
+/**
+ * @file bench_active.cpp
+ * @brief Wall time of active-region tracking on the test cases
+ *
+ * Usage: bench_active [order] [repeats] [num_cells]
+ *
+ * Runs the 12 test cases of data/ at the given order (num_cells 0 keeps the
+ * configured mesh), sweeping every cell and then with
+ * ExecutionConfig::active_regions. It reports the best wall time of
+ * `repeats` runs for both, the fraction of cell updates skipped, and the
+ * largest difference in density between the two solutions. Test case 7
+ * runs to t = 200 and takes most of the total.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <print>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int order = bench::arg_or(argc, argv, 1, 2);
+    const int repeats = bench::arg_or(argc, argv, 2, 3);
+    const int num_cells = bench::arg_or(argc, argv, 3, 0);
+
+    std::println("Order {}: best of {} runs", order, repeats);
+    std::println("{:>6} {:>7} {:>10} {:>10} {:>8} {:>9} {:>10}", "case", "steps", "full (s)", "active (s)", "speedup",
+                 "skipped", "max |drho|");
+    double total_full = 0.0;
+    double total_active = 0.0;
+    for (int k = 1; k <= 12; ++k) {
+        Config config = parse_config(std::format("data/test_case{}.toml", k));
+        config.numerics.order = order;
+        if (num_cells > 0) {
+            config.mesh.num_cells = num_cells;
+        }
+
+        const auto best_of = [&](bool active, auto&& inspect) {
+            config.execution.active_regions = active;
+            double seconds = 0.0;
+            for (int r = 0; r < repeats; ++r) {
+                Solver solver(config);
+                const double run_seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+                seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+                if (r == 0) {
+                    inspect(solver);
+                }
+            }
+            return seconds;
+        };
+
+        BasicConservativeArray<Real> U_full;
+        int steps = 0;
+        const double full_seconds = best_of(false, [&](const Solver& solver) {
+            U_full.assign(solver.solution().begin(), solver.solution().end());
+            steps = solver.steps();
+        });
+        double skipped = 0.0;
+        double max_diff = 0.0;
+        const double active_seconds = best_of(true, [&](const Solver& solver) {
+            const auto updates = solver.cell_update_counts();
+            skipped = static_cast<double>(updates.skipped) / static_cast<double>(updates.updated + updates.skipped);
+            for (std::size_t i = 0; i < U_full.size(); ++i) {
+                max_diff = std::max(max_diff, static_cast<double>(std::abs(solver.solution()[i].rho - U_full[i].rho)));
+            }
+        });
+        total_full += full_seconds;
+        total_active += active_seconds;
+        std::println("{:>6} {:>7} {:>10.3f} {:>10.3f} {:>7.2f}x {:>8.1f}% {:>10.2e}", k, steps, full_seconds,
+                     active_seconds, full_seconds / active_seconds, 100.0 * skipped, max_diff);
+    }
+    std::println("{:>6} {:>7} {:>10.3f} {:>10.3f} {:>7.2f}x", "total", "", total_full, total_active,
+                 total_full / total_active);
+
+    return 0;
+}
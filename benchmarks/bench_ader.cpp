@@ -0,0 +1,68 @@
+/**
+ * @file bench_ader.cpp
+ * @brief Time to accuracy of SSPRK3 + MUSCL, MUSCL-Hancock and ADER
+ *
+ * Usage: bench_ader [config] [reference_cells]
+ *
+ * Runs the configuration (default: the shock-entropy interaction of
+ * data/test_case11.toml) with HLLC at 256 to 2048 cells for each scheme, and
+ * reports the wall time and the L1 density error against an ADER run on
+ * reference_cells cells, averaged onto the coarse mesh. Reading down a
+ * column gives the error each scheme buys per second.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <print>
+#include <string_view>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const std::string path = (argc > 1) ? argv[1] : "data/test_case11.toml";
+    const int reference_cells = bench::arg_or(argc, argv, 2, 16384);
+
+    Config config = parse_config(path);
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+
+    config.mesh.num_cells = reference_cells;
+    config.time.integrator = TimeIntegrator::ADER;
+    Solver reference(config);
+    reference.advance_to(config.time.final_time);
+    const auto U_ref = reference.interior();
+
+    const std::pair<std::string_view, TimeIntegrator> schemes[] = {
+        {"ssprk3", TimeIntegrator::SSPRK3},
+        {"hancock", TimeIntegrator::MUSCLHancock},
+        {"ader", TimeIntegrator::ADER},
+    };
+
+    std::println("{}: t = {}, reference ADER on {} cells", path, config.time.final_time, reference_cells);
+    std::println("{:>10} {:>7} {:>8} {:>11} {:>10}", "scheme", "cells", "steps", "time (s)", "L1 rho");
+
+    for (const auto& [name, integrator] : schemes) {
+        for (int num_cells = 256; num_cells <= 2048; num_cells *= 2) {
+            config.mesh.num_cells = num_cells;
+            config.time.integrator = integrator;
+            Solver solver(config);
+            const double seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+
+            const int ratio = reference_cells / num_cells;
+            double l1 = 0.0;
+            for (int i = 0; i < num_cells; ++i) {
+                double rho_ref = 0.0;
+                for (int j = i * ratio; j < (i + 1) * ratio; ++j) {
+                    rho_ref += U_ref[static_cast<std::size_t>(j)].rho;
+                }
+                l1 += std::abs(solver.interior()[static_cast<std::size_t>(i)].rho - rho_ref / ratio);
+            }
+            l1 *= solver.mesh().dx();
+            std::println("{:>10} {:>7} {:>8} {:>11.4f} {:>10.3e}", name, num_cells, solver.steps(), seconds, l1);
+        }
+    }
+
+    return 0;
+}
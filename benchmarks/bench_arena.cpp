@@ -0,0 +1,57 @@
+/**
+ * @file bench_arena.cpp
+ * @brief Ensemble throughput with solver arrays from the heap and from a reused arena
+ *
+ * Usage: bench_arena [num_cells] [members] [steps]
+ *
+ * Every member is a fresh Sod solver run for a fixed number of steps, as in
+ * a parameter sweep. With the arena, the members share one reservation that
+ * is reset between them, and the per-step stage arrays of the integrator
+ * are carved from the same memory every step.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/memory/arena.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <print>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const int members = bench::arg_or(argc, argv, 2, 200);
+    const int steps = bench::arg_or(argc, argv, 3, 20);
+
+    Config config = bench::make_sod_config(num_cells);
+    config.numerics.order = 2;
+    config.time.final_time = bench::sod_final_time(config, steps);
+
+    std::println("Sod ensemble: {} members, {} cells, ~{} SSPRK3 steps each", members, num_cells, steps);
+    std::println("{:>10} {:>14} {:>14} {:>12}", "storage", "time (s)", "ms/member", "peak (MiB)");
+
+    const double heap_seconds = bench::time_seconds([&] {
+        for (int m = 0; m < members; ++m) {
+            Solver solver(config);
+            solver.advance_to(config.time.final_time);
+        }
+    });
+    std::println("{:>10} {:>14.4f} {:>14.3f} {:>12}", "heap", heap_seconds, 1e3 * heap_seconds / members, "-");
+
+    Arena arena(std::size_t{64} << 20);
+    const double arena_seconds = bench::time_seconds([&] {
+        for (int m = 0; m < members; ++m) {
+            {
+                Solver solver(config, &arena);
+                solver.advance_to(config.time.final_time);
+            }
+            arena.reset();
+        }
+    });
+    const auto stats = arena.stats();
+    std::println("{:>10} {:>14.4f} {:>14.3f} {:>12.2f}", "arena", arena_seconds, 1e3 * arena_seconds / members,
+                 static_cast<double>(stats.peak) / (1024.0 * 1024.0));
+    std::println("Arena: {} allocations, {} bytes from the heap; speedup {:.2f}x", stats.allocations,
+                 stats.overflow_bytes, heap_seconds / arena_seconds);
+
+    return 0;
+}
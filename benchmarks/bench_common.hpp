@@ -0,0 +1,93 @@
+/**
+ * @file bench_common.hpp
+ * @brief Shared helpers for the benchmark executables
+ */
+
+#ifndef EULER1D_BENCHMARKS_BENCH_COMMON_HPP
+#define EULER1D_BENCHMARKS_BENCH_COMMON_HPP
+
+#include "euler1d/config/config_types.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace euler1d::bench {
+
+/// Sod shock tube on [0, 1] with transmissive boundaries
+inline Config make_sod_config(int num_cells) {
+    Config config;
+    config.simulation.test_name = "bench_sod";
+    config.mesh = MeshConfig{Real{0}, Real{1}, num_cells};
+    config.time.cfl = Real{0.5};
+    config.time.integrator = TimeIntegrator::SSPRK3;
+    config.initial_condition.type = InitialConditionType::PiecewiseConstant;
+    config.initial_condition.regions = {
+        Region{Real{0}, Real{0.5}, Real{1}, Real{0}, Real{1}, {}},
+        Region{Real{0.5}, Real{1}, Real{0.125}, Real{0}, Real{0.1}, {}}
+    };
+    return config;
+}
+
+/// Final time that gives roughly `steps` steps for a Sod run on `num_cells` cells
+inline Real sod_final_time(const Config& config, int steps) {
+    // Fastest Sod signal is the left rarefaction head plus the shock, |u| + c < 2
+    const Real dx = (config.mesh.xmax - config.mesh.xmin) / static_cast<Real>(config.mesh.num_cells);
+    return static_cast<Real>(steps) * config.time.cfl * dx / Real{2};
+}
+
+/// Integer command-line argument with default
+inline int arg_or(int argc, char* argv[], int index, int fallback) {
+    return (argc > index) ? std::atoi(argv[index]) : fallback;
+}
+
+/// Wall-clock seconds spent in f()
+template <typename F>
+double time_seconds(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/// Density of an analytical reference file (columns x, rho, u, p, e), linearly interpolated
+struct DensityReference {
+    std::vector<double> x;
+    std::vector<double> rho;
+
+    explicit DensityReference(const std::string& path) {
+        std::ifstream in(path);
+        double x_k, rho_k, u_k, p_k, e_k;
+        while (in >> x_k >> rho_k >> u_k >> p_k >> e_k) {
+            x.push_back(x_k);
+            rho.push_back(rho_k);
+        }
+    }
+
+    [[nodiscard]] double operator()(double x_i) const {
+        const auto it = std::lower_bound(x.begin(), x.end(), x_i);
+        if (it == x.begin()) return rho.front();
+        if (it == x.end()) return rho.back();
+        const auto k = static_cast<std::size_t>(it - x.begin());
+        const double w = (x_i - x[k - 1]) / (x[k] - x[k - 1]);
+        return (1.0 - w) * rho[k - 1] + w * rho[k];
+    }
+
+    /// L1 density error of a solver's interior cells against the reference at the cell centres
+    template <typename Solver>
+    [[nodiscard]] double l1_error(const Solver& solver) const {
+        double sum = 0.0;
+        for (int i = solver.mesh().first_interior(); i <= solver.mesh().last_interior(); ++i) {
+            sum += std::abs(static_cast<double>(solver.solution()[static_cast<std::size_t>(i)].rho) -
+                            (*this)(solver.mesh().x(i)));
+        }
+        return sum * solver.mesh().dx();
+    }
+};
+
+}  // namespace euler1d::bench
+
+#endif  // EULER1D_BENCHMARKS_BENCH_COMMON_HPP
@@ -0,0 +1,72 @@
+/**
+ * @file bench_expand.cpp
+ * @brief Wall time of the expanding window against the full mesh on long tubes
+ *
+ * Usage: bench_expand [order] [repeats] [cells_per_unit]
+ *
+ * Runs Toro test case 1 (Sod with a sonic point, waves within [0, 1] at
+ * t = 0.2) in tubes of increasing length at a fixed resolution, once on the
+ * whole mesh and once with MeshConfig::expand. It reports the best wall time
+ * of `repeats` runs for both, the peak window size against the domain, and
+ * the largest difference in density after the window is fitted back to the
+ * domain.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int order = bench::arg_or(argc, argv, 1, 2);
+    const int repeats = bench::arg_or(argc, argv, 2, 3);
+    const int cells_per_unit = bench::arg_or(argc, argv, 3, 1000);
+
+    std::println("Order {}, {} cells per unit length: best of {} runs", order, cells_per_unit, repeats);
+    std::println("{:>7} {:>8} {:>10} {:>10} {:>8} {:>12} {:>10}", "length", "cells", "full (s)", "window (s)",
+                 "speedup", "peak window", "max |drho|");
+    for (const int length : {1, 4, 16, 64}) {
+        Config config = parse_config("data/test_case1.toml");
+        config.numerics.order = order;
+        config.mesh.xmin = 0.5 - 0.5 * length;
+        config.mesh.xmax = 0.5 + 0.5 * length;
+        config.mesh.num_cells = length * cells_per_unit;
+        config.initial_condition.regions.front().x_left = config.mesh.xmin;
+        config.initial_condition.regions.back().x_right = config.mesh.xmax;
+
+        const auto best_of = [&](bool expand, auto&& inspect) {
+            config.mesh.expand = expand;
+            double seconds = 0.0;
+            for (int r = 0; r < repeats; ++r) {
+                Solver solver(config);
+                const double run_seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+                seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+                if (r == 0) {
+                    inspect(solver);
+                }
+            }
+            return seconds;
+        };
+
+        BasicConservativeArray<Real> U_full;
+        const double full_seconds =
+            best_of(false, [&](Solver& solver) { U_full.assign(solver.solution().begin(), solver.solution().end()); });
+        int peak = 0;
+        double max_diff = 0.0;
+        const double window_seconds = best_of(true, [&](Solver& solver) {
+            peak = solver.window_stats().peak_cells;
+            solver.fit_window_to_domain();
+            for (std::size_t i = 0; i < U_full.size(); ++i) {
+                max_diff = std::max(max_diff, static_cast<double>(std::abs(solver.solution()[i].rho - U_full[i].rho)));
+            }
+        });
+        std::println("{:>7} {:>8} {:>10.3f} {:>10.3f} {:>7.2f}x {:>12} {:>10.2e}", length, config.mesh.num_cells,
+                     full_seconds, window_seconds, full_seconds / window_seconds, peak, max_diff);
+    }
+
+    return 0;
+}
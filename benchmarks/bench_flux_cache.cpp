@@ -0,0 +1,72 @@
+/**
+ * @file bench_flux_cache.cpp
+ * @brief First-order flux loop with per-face and with per-cell state evaluation
+ *
+ * Usage: bench_flux_cache [num_cells] [sweeps]
+ *
+ * Per face, each side's velocity, pressure, sound speed and physical flux
+ * are evaluated from its conservative state, so every cell pays for them
+ * twice. With the cell cache they are evaluated once per cell in a separate
+ * pass, and the flux loop reads them.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/eos/eos.hpp"
+#include "euler1d/flux/flux.hpp"
+#include <cmath>
+#include <print>
+#include <span>
+#include <string_view>
+#include <vector>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const int sweeps = bench::arg_or(argc, argv, 2, 2000);
+    const auto n = static_cast<std::size_t>(num_cells);
+
+    const IdealGas eos{1.4};
+    std::vector<ConservativeVars> U(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Real x = static_cast<Real>(i) / static_cast<Real>(n);
+        U[i] = eos.to_conservative(PrimitiveVars{1.0 + 0.5 * std::sin(6.0 * x), 0.3 * std::cos(4.0 * x),
+                                                 1.0 + 0.2 * std::sin(9.0 * x)});
+    }
+    std::vector<ConservativeVars> F(n - 1);
+    BasicCellCache<Real> cells;
+    cells.resize(n);
+
+    const std::pair<std::string_view, FluxVariant> fluxes[] = {
+        {"llf", LLFFlux{}}, {"rusanov", RusanovFlux{}}, {"hll", HLLFlux{}},
+        {"hllc", HLLCFlux{}}, {"movers_le", MoversLEFlux{}},
+    };
+
+    std::println("Flux loop: {} cells, {} sweeps", num_cells, sweeps);
+    std::println("{:>10} {:>16} {:>16} {:>10}", "flux", "per-face (ns)", "cached (ns)", "speedup");
+
+    Real checksum = 0.0;
+    for (const auto& [name, flux] : fluxes) {
+        const double face_seconds = bench::time_seconds([&] {
+            for (int s = 0; s < sweeps; ++s) {
+                for (std::size_t i = 0; i + 1 < n; ++i) F[i] = compute_flux(flux, U[i], U[i + 1], eos);
+                checksum += F[n / 2].E;
+            }
+        });
+        const double cached_seconds = bench::time_seconds([&] {
+            for (int s = 0; s < sweeps; ++s) {
+                cells.fill(std::span<const ConservativeVars>(U), eos);
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    F[i] = compute_flux(flux, cells(i, U[i]), cells(i + 1, U[i + 1]), eos);
+                }
+                checksum += F[n / 2].E;
+            }
+        });
+        const double faces = static_cast<double>(sweeps) * static_cast<double>(n - 1);
+        std::println("{:>10} {:>16.2f} {:>16.2f} {:>9.2f}x", name, 1e9 * face_seconds / faces,
+                     1e9 * cached_seconds / faces, face_seconds / cached_seconds);
+    }
+    std::println("checksum {:.6e}", checksum);
+
+    return 0;
+}
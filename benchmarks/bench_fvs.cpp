@@ -0,0 +1,94 @@
+/**
+ * @file bench_fvs.cpp
+ * @brief First-order face throughput of the flux-vector-splitting and AUSM schemes against HLLC
+ *
+ * Usage: bench_fvs [num_cells] [sweeps] [steps]
+ *
+ * The flux loop column fills the per-cell buffer the solver uses for the
+ * scheme (split fluxes for Steger-Warming and Van Leer, cell states
+ * otherwise) and evaluates every face, as compute_rhs does at first order.
+ * The solver column runs first-order Sod with SSPRK3 and counts each face of
+ * each stage.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/eos/eos.hpp"
+#include "euler1d/flux/flux.hpp"
+#include "euler1d/solver/factory.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <print>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const int sweeps = bench::arg_or(argc, argv, 2, 2000);
+    const int steps = bench::arg_or(argc, argv, 3, 400);
+    const auto n = static_cast<std::size_t>(num_cells);
+
+    const IdealGas eos{1.4};
+    std::vector<ConservativeVars> U(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Real x = static_cast<Real>(i) / static_cast<Real>(n);
+        U[i] = eos.to_conservative(PrimitiveVars{1.0 + 0.5 * std::sin(6.0 * x), 0.8 * std::cos(4.0 * x),
+                                                 1.0 + 0.2 * std::sin(9.0 * x)});
+    }
+    std::vector<ConservativeVars> F(n - 1);
+    BasicCellCache<Real> cells;
+    cells.resize(n);
+    BasicSplitFluxCache<Real> split;
+    split.resize(n);
+
+    const std::pair<std::string_view, FluxScheme> schemes[] = {
+        {"hllc", FluxScheme::HLLC}, {"steger_warming", FluxScheme::StegerWarming},
+        {"van_leer", FluxScheme::VanLeer}, {"ausm_plus", FluxScheme::AUSMPlus},
+        {"ausm_plus_up", FluxScheme::AUSMPlusUp},
+    };
+
+    Config config = bench::make_sod_config(num_cells);
+    config.numerics.order = 1;
+    config.time.final_time = bench::sod_final_time(config, steps);
+
+    std::println("{} cells, {} sweeps, Sod to ~{} steps", num_cells, sweeps, steps);
+    std::println("{:>14} {:>10} {:>16} {:>16} {:>10}", "flux", "ns/face", "loop Mfaces/s", "solver Mfaces/s",
+                 "vs hllc");
+
+    Real checksum = 0.0;
+    double hllc_rate = 0.0;
+    for (const auto& [name, scheme] : schemes) {
+        const FluxVariant flux = create_flux(scheme);
+        const double seconds = bench::time_seconds([&] {
+            std::visit([&](const auto& f) {
+                for (int s = 0; s < sweeps; ++s) {
+                    if constexpr (VectorSplitFlux<std::decay_t<decltype(f)>>) {
+                        split.fill(std::span<const ConservativeVars>(U), eos, f);
+                        for (std::size_t i = 0; i + 1 < n; ++i) F[i] = split(i);
+                    } else {
+                        cells.fill(std::span<const ConservativeVars>(U), eos);
+                        for (std::size_t i = 0; i + 1 < n; ++i) F[i] = f(cells(i, U[i]), cells(i + 1, U[i + 1]), eos);
+                    }
+                    checksum += F[n / 2].E;
+                }
+            }, flux);
+        });
+        const double faces = static_cast<double>(sweeps) * static_cast<double>(n - 1);
+        const double rate = faces / seconds;
+        if (scheme == FluxScheme::HLLC) hllc_rate = rate;
+
+        config.numerics.flux = scheme;
+        Solver solver(config);
+        const double solver_seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+        const double solver_faces = 3.0 * static_cast<double>(solver.steps()) * static_cast<double>(num_cells + 1);
+
+        std::println("{:>14} {:>10.2f} {:>16.1f} {:>16.1f} {:>9.2f}x", name, 1e9 / rate, 1e-6 * rate,
+                     1e-6 * solver_faces / solver_seconds, rate / hllc_rate);
+    }
+    std::println("checksum {:.6e}", checksum);
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file bench_hancock.cpp
+ * @brief Second-order Sod runs with MUSCL + SSPRK3 and with MUSCL-Hancock
+ *
+ * Usage: bench_hancock [num_cells] [steps]
+ *
+ * Both runs go to the same final time at the same CFL number. SSPRK3
+ * evaluates the RHS three times per step, MUSCL-Hancock once (with a
+ * predictor per cell). The L1 column is the density distance between the
+ * two solutions.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <print>
+#include <string_view>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const int steps = bench::arg_or(argc, argv, 2, 200);
+
+    Config config = bench::make_sod_config(num_cells);
+    config.numerics.order = 2;
+    config.time.final_time = bench::sod_final_time(config, steps);
+
+    const std::pair<std::string_view, FluxScheme> fluxes[] = {
+        {"llf", FluxScheme::LLF}, {"rusanov", FluxScheme::Rusanov}, {"hll", FluxScheme::HLL},
+        {"hllc", FluxScheme::HLLC}, {"movers_le", FluxScheme::MoversLE},
+    };
+
+    std::println("Sod: {} cells, ~{} steps, vanleer slopes", num_cells, steps);
+    std::println("{:>10} {:>13} {:>13} {:>9} {:>10}", "flux", "ssprk3 (s)", "hancock (s)", "speedup", "L1 rho");
+
+    for (const auto& [name, flux] : fluxes) {
+        config.numerics.flux = flux;
+
+        config.time.integrator = TimeIntegrator::SSPRK3;
+        Solver ssprk3(config);
+        const double ssprk3_seconds = bench::time_seconds([&] { ssprk3.advance_to(config.time.final_time); });
+
+        config.time.integrator = TimeIntegrator::MUSCLHancock;
+        Solver hancock(config);
+        const double hancock_seconds = bench::time_seconds([&] { hancock.advance_to(config.time.final_time); });
+
+        double l1 = 0.0;
+        for (int i = hancock.mesh().first_interior(); i <= hancock.mesh().last_interior(); ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            l1 += std::abs(hancock.solution()[k].rho - ssprk3.solution()[k].rho) * hancock.mesh().dx();
+        }
+        std::println("{:>10} {:>13.4f} {:>13.4f} {:>8.2f}x {:>10.2e}", name, ssprk3_seconds, hancock_seconds,
+                     ssprk3_seconds / hancock_seconds, l1);
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file bench_hybrid.cpp
+ * @brief Cost and accuracy of the shock-sensor hybrid flux against its two component fluxes
+ *
+ * Usage: bench_hybrid [order] [repeats] [sensor_threshold]
+ *
+ * Runs test cases of data/ at the given order with LLF, then HLLC and
+ * MOVERS-LE each with and without hybrid_flux. It reports the L1 density
+ * error against the analytical reference, the best wall time of `repeats`
+ * runs, and for the hybrid runs the fraction of faces the sensor flagged.
+ * MOVERS-LE does not survive the strong rarefactions of cases 3 and 5.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <print>
+#include <string_view>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int order = bench::arg_or(argc, argv, 1, 2);
+    const int repeats = bench::arg_or(argc, argv, 2, 3);
+    const Real threshold = (argc > 3) ? static_cast<Real>(std::atof(argv[3])) : NumericsConfig{}.sensor_threshold;
+
+    struct Scheme {
+        std::string_view name;
+        FluxScheme flux;
+        bool hybrid;
+    };
+    const Scheme schemes[] = {
+        {"llf", FluxScheme::LLF, false},
+        {"hllc", FluxScheme::HLLC, false},
+        {"hybrid hllc", FluxScheme::HLLC, true},
+        {"movers_le", FluxScheme::MoversLE, false},
+        {"hybrid movers", FluxScheme::MoversLE, true},
+    };
+
+    std::println("Order {}, sensor threshold {}: L1 rho error, time (s), flagged faces", order, threshold);
+    std::print("{:>6}", "case");
+    for (const auto& scheme : schemes) std::print(" {:>26}", scheme.name);
+    std::println("");
+    for (const int k : {1, 3, 5, 11, 12}) {
+        Config config = parse_config(std::format("data/test_case{}.toml", k));
+        config.numerics.order = order;
+        config.numerics.sensor_threshold = threshold;
+        config.time.max_retries = 0;
+        const bench::DensityReference reference(std::format("data/analytical_ref_test_case{}.dat", k));
+
+        std::print("{:>6}", k);
+        for (const auto& scheme : schemes) {
+            config.numerics.flux = scheme.flux;
+            config.numerics.hybrid_flux = scheme.hybrid;
+            double seconds = 0.0;
+            double l1 = 0.0;
+            double flagged = 0.0;
+            try {
+                for (int r = 0; r < repeats; ++r) {
+                    Solver solver(config);
+                    const double run_seconds =
+                        bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+                    seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+                    l1 = reference.l1_error(solver);
+                    const auto counts = solver.hybrid_face_counts();
+                    const auto faces = counts.smooth_faces + counts.sharp_faces;
+                    flagged = (faces > 0) ? static_cast<double>(counts.sharp_faces) / static_cast<double>(faces) : 0.0;
+                }
+            } catch (const std::exception&) {
+                std::print(" {:>26}", "failed");
+                continue;
+            }
+            if (scheme.hybrid) {
+                std::print(" {:>9.3e} {:>7.3f} {:>7.1f}%", l1, seconds, 100.0 * flagged);
+            } else {
+                std::print(" {:>9.3e} {:>7.3f} {:>8}", l1, seconds, "");
+            }
+        }
+        std::println("");
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file bench_implicit.cpp
+ * @brief Time to solution of the implicit integrators at large CFL numbers
+ *
+ * Usage: bench_implicit [num_cells] [final_time]
+ *
+ * A weak pressure step rings in a closed tube (reflective walls) for several
+ * acoustic transits. SSPRK3 at CFL 0.5 is the reference; backward Euler and
+ * BDF2 run at CFL 10-100 with the block Thomas solver, and once with PCR.
+ * The error column is the L1 density difference to the reference, which
+ * shows what the large steps cost in acoustic accuracy.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <print>
+
+using namespace euler1d;
+
+namespace {
+
+Config make_acoustic_config(int num_cells, Real final_time) {
+    Config config = bench::make_sod_config(num_cells);
+    config.simulation.test_name = "bench_acoustic";
+    config.time.final_time = final_time;
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    config.boundary = BoundaryConfig{BoundaryType::Reflective, BoundaryType::Reflective};
+    config.initial_condition.regions = {
+        Region{Real{0}, Real{0.5}, Real{1}, Real{0}, Real{1.01}, {}},
+        Region{Real{0.5}, Real{1}, Real{1}, Real{0}, Real{1}, {}}
+    };
+    return config;
+}
+
+/// L1 norm of the density difference over the interior
+double density_l1(const Solver& a, const Solver& b) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < a.interior().size(); ++i) {
+        sum += std::abs(static_cast<double>(a.interior()[i].rho - b.interior()[i].rho));
+    }
+    return sum * static_cast<double>(a.mesh().dx());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const Real final_time = (argc > 2) ? static_cast<Real>(std::atof(argv[2])) : Real{1};
+
+    std::println("Acoustic ringing in a closed tube: {} cells, t = {}, order 2, HLLC", num_cells, final_time);
+    std::println("{:>16} {:>8} {:>8} {:>10} {:>10} {:>10} {:>12}",
+                 "integrator", "solver", "CFL", "steps", "time (s)", "speedup", "L1(rho)");
+
+    auto config = make_acoustic_config(num_cells, final_time);
+    config.time.cfl = Real{0.5};
+    Solver reference(config);
+    const double reference_seconds = bench::time_seconds([&] { reference.run(); });
+    std::println("{:>16} {:>8} {:>8.1f} {:>10} {:>10.4f} {:>10} {:>12}",
+                 "ssprk3", "-", config.time.cfl, reference.steps(), reference_seconds, "1.0", "-");
+
+    struct Run {
+        TimeIntegrator integrator;
+        const char* name;
+        LinearSolver linear_solver;
+        Real cfl;
+    };
+    const Run runs[] = {
+        {TimeIntegrator::BackwardEuler, "backward_euler", LinearSolver::Thomas, Real{10}},
+        {TimeIntegrator::BackwardEuler, "backward_euler", LinearSolver::Thomas, Real{30}},
+        {TimeIntegrator::BackwardEuler, "backward_euler", LinearSolver::Thomas, Real{100}},
+        {TimeIntegrator::BDF2, "bdf2", LinearSolver::Thomas, Real{10}},
+        {TimeIntegrator::BDF2, "bdf2", LinearSolver::Thomas, Real{30}},
+        {TimeIntegrator::BDF2, "bdf2", LinearSolver::Thomas, Real{100}},
+        {TimeIntegrator::BDF2, "bdf2", LinearSolver::PCR, Real{30}},
+    };
+    for (const auto& run : runs) {
+        config.time.integrator = run.integrator;
+        config.time.linear_solver = run.linear_solver;
+        config.time.cfl = run.cfl;
+        Solver solver(config);
+        const double seconds = bench::time_seconds([&] { solver.run(); });
+        std::println("{:>16} {:>8} {:>8.1f} {:>10} {:>10.4f} {:>10.1f} {:>12.3e}",
+                     run.name, run.linear_solver == LinearSolver::PCR ? "pcr" : "thomas", run.cfl,
+                     solver.steps(), seconds, reference_seconds / seconds, density_l1(solver, reference));
+    }
+
+    return 0;
+}
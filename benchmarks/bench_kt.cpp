@@ -0,0 +1,107 @@
+/**
+ * @file bench_kt.cpp
+ * @brief Cost and accuracy of the central-upwind (branch-free HLL) flux against LLF and HLLC
+ *
+ * Usage: bench_kt [repeats] [num_cells] [sweeps]
+ *
+ * The Kurganov-Tadmor central-upwind flux is HLL with Davis speeds, and
+ * HLLFlux evaluates it in that branch-free form, so the "hll" column is
+ * also "kurganov_tadmor".
+ *
+ * The first table times the first-order flux loop as compute_rhs runs it
+ * (cell cache fill included), in ns per face. The second runs test cases of
+ * data/ at second order with MUSCL and SSPRK3 (case 11 and 12 are the
+ * smooth-dominated shock-entropy problems). It reports the L1 density error
+ * against the analytical reference and the best wall time of `repeats` runs.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/eos/eos.hpp"
+#include "euler1d/flux/flux.hpp"
+#include "euler1d/solver/factory.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <print>
+#include <span>
+#include <string_view>
+#include <vector>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int repeats = bench::arg_or(argc, argv, 1, 3);
+    const int num_cells = bench::arg_or(argc, argv, 2, 4096);
+    const int sweeps = bench::arg_or(argc, argv, 3, 2000);
+    const auto n = static_cast<std::size_t>(num_cells);
+
+    const std::pair<std::string_view, FluxScheme> schemes[] = {
+        {"llf", FluxScheme::LLF}, {"hll", FluxScheme::HLL}, {"hllc", FluxScheme::HLLC},
+    };
+
+    // Flux loop cost
+    const IdealGas eos{1.4};
+    std::vector<ConservativeVars> U(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Real x = static_cast<Real>(i) / static_cast<Real>(n);
+        U[i] = eos.to_conservative(PrimitiveVars{1.0 + 0.5 * std::sin(6.0 * x), 0.8 * std::cos(4.0 * x),
+                                                 1.0 + 0.2 * std::sin(9.0 * x)});
+    }
+    std::vector<ConservativeVars> F(n - 1);
+    BasicCellCache<Real> cells;
+    cells.resize(n);
+
+    std::println("First-order flux loop: {} cells, {} sweeps", num_cells, sweeps);
+    Real checksum = 0.0;
+    const double faces = static_cast<double>(sweeps) * static_cast<double>(n - 1);
+    for (const auto& [name, scheme] : schemes) {
+        const FluxVariant flux = create_flux(scheme);
+        double seconds = 0.0;
+        for (int r = 0; r < repeats; ++r) {
+            const double run_seconds = bench::time_seconds([&] {
+                std::visit([&](const auto& f) {
+                    for (int s = 0; s < sweeps; ++s) {
+                        cells.fill(std::span<const ConservativeVars>(U), eos);
+                        for (std::size_t i = 0; i + 1 < n; ++i) F[i] = f(cells(i, U[i]), cells(i + 1, U[i + 1]), eos);
+                        checksum += F[n / 2].E;
+                    }
+                }, flux);
+            });
+            seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+        }
+        std::println("{:>6} {:>8.2f} ns/face", name, 1e9 * seconds / faces);
+    }
+    std::println("checksum {:.6e}\n", checksum);
+
+    // Accuracy and cost at second order
+    std::println("Second order, MUSCL + SSPRK3: L1 rho error, time (s)");
+    std::print("{:>6}", "case");
+    for (const auto& [name, scheme] : schemes) std::print(" {:>19}", name);
+    std::println("");
+    for (const int k : {1, 3, 5, 11, 12}) {
+        Config config = parse_config(std::format("data/test_case{}.toml", k));
+        config.numerics.order = 2;
+        config.time.integrator = TimeIntegrator::SSPRK3;
+        const bench::DensityReference reference(std::format("data/analytical_ref_test_case{}.dat", k));
+
+        std::print("{:>6}", k);
+        for (const auto& [name, scheme] : schemes) {
+            config.numerics.flux = scheme;
+            double seconds = 0.0;
+            double l1 = 0.0;
+            // Run 0 warms up and is not timed, or the first column of a row pays for it
+            for (int r = 0; r <= repeats; ++r) {
+                Solver solver(config);
+                const double run_seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+                seconds = (r <= 1) ? run_seconds : std::min(seconds, run_seconds);
+                l1 = reference.l1_error(solver);
+            }
+            std::print(" {:>9.3e} {:>9.3f}", l1, seconds);
+        }
+        std::println("");
+    }
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file bench_pages.cpp
+ * @brief Throughput of a large mesh under the page placement options
+ *
+ * Usage: bench_pages [num_cells] [steps] [threads]
+ *
+ * Runs the same Sod problem with the arrays on the heap, in an arena of base
+ * pages, of transparent and of explicit huge pages, and finally with huge
+ * pages and parallel first touch. Explicit pages need a hugetlbfs pool
+ * (vm.nr_hugepages); without one the arena falls back to transparent pages,
+ * which the "pages" column shows.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <print>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 1 << 22);
+    const int steps = bench::arg_or(argc, argv, 2, 10);
+    const int threads = bench::arg_or(argc, argv, 3, 1);
+
+    struct Variant {
+        const char* name;
+        HugePages huge_pages;
+        bool first_touch;
+    };
+    const Variant variants[] = {
+        {"heap", HugePages::None, false},
+        {"base", HugePages::None, true},
+        {"transparent", HugePages::Transparent, false},
+        {"explicit", HugePages::Explicit, false},
+        {"thp+touch", HugePages::Transparent, true},
+    };
+    constexpr const char* page_names[] = {"base", "transparent", "explicit"};
+
+    std::println("Sod: {} cells, ~{} SSPRK3 steps, order 2, {} threads", num_cells, steps, threads);
+    std::println("{:>12} {:>12} {:>12} {:>12} {:>14}", "variant", "pages", "wall [s]", "Mcell/s", "huge MiB");
+
+    for (const auto& variant : variants) {
+        auto config = bench::make_sod_config(num_cells);
+        config.numerics.order = 2;
+        config.execution.threads = threads;
+        config.execution.huge_pages = variant.huge_pages;
+        config.execution.first_touch = variant.first_touch;
+        config.time.final_time = bench::sod_final_time(config, steps);
+
+        Solver solver(config);
+        const double seconds = bench::time_seconds([&] { solver.advance_to(config.time.final_time); });
+        const double updates = static_cast<double>(solver.steps()) * static_cast<double>(num_cells);
+
+        const Arena* arena = solver.arena();
+        const char* pages = arena != nullptr ? page_names[static_cast<int>(arena->stats().pages)] : "-";
+        const double huge_mib = arena != nullptr
+                                    ? static_cast<double>(arena->page_usage().huge_page_bytes) / (1024.0 * 1024.0)
+                                    : 0.0;
+        std::println("{:>12} {:>12} {:>12.4f} {:>12.2f} {:>14.1f}", variant.name, pages, seconds,
+                     1.0e-6 * updates / seconds, huge_mib);
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file bench_positivity.cpp
+ * @brief Cost and effect of the positivity guard
+ *
+ * Usage: bench_positivity [num_cells] [steps] [repeats]
+ *
+ * Part 1 times a smooth periodic density wave with the guard off and on,
+ * where no face should need correcting; runs are interleaved and the best
+ * of `repeats` is reported. Part 2 runs a near-vacuum double rarefaction
+ * (Toro test 2 with |u| = 5) with Superbee + HLLC and reports whether the
+ * solution stays physical and how many faces were corrected.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+
+using namespace euler1d;
+
+namespace {
+
+/// Smooth density wave advected through a periodic box
+Config make_smooth_config(int num_cells) {
+    Config config;
+    config.simulation.test_name = "bench_smooth";
+    config.mesh = MeshConfig{Real{-1}, Real{1}, num_cells};
+    config.time.cfl = Real{0.5};
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    config.boundary = BoundaryConfig{BoundaryType::Periodic, BoundaryType::Periodic};
+    config.initial_condition.type = InitialConditionType::ShockEntropyInteraction;
+    config.initial_condition.discontinuity_position = Real{-1};
+    config.initial_condition.right_state = SinusoidalState{Real{1}, Real{0.2}, Real{5}, true, Real{1}, Real{1}};
+    return config;
+}
+
+/// Toro test 2 with stronger outgoing velocities
+Config make_rarefaction_config(int num_cells, bool positivity) {
+    Config config = bench::make_sod_config(num_cells);
+    config.simulation.test_name = "bench_double_rarefaction";
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    config.numerics.limiter = Limiter::Superbee;
+    config.numerics.positivity = positivity;
+    config.time.final_time = Real{0.15};
+    config.initial_condition.regions = {
+        Region{Real{0}, Real{0.5}, Real{1}, Real{-5}, Real{0.4}, {}},
+        Region{Real{0.5}, Real{1}, Real{1}, Real{5}, Real{0.4}, {}}
+    };
+    return config;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 1 << 16);
+    const int steps = bench::arg_or(argc, argv, 2, 100);
+    const int repeats = bench::arg_or(argc, argv, 3, 5);
+
+    std::println("Smooth wave: {} cells, ~{} steps, order 2, HLLC, best of {}", num_cells, steps, repeats);
+    std::println("{:>10} {:>12} {:>12} {:>16}", "guard", "Mcell/s", "overhead", "corrected faces");
+
+    double best[2] = {0.0, 0.0};
+    std::int64_t corrected[2] = {0, 0};
+    for (int r = 0; r < repeats; ++r) {
+        for (int guard = 0; guard < 2; ++guard) {
+            auto config = make_smooth_config(num_cells);
+            config.numerics.positivity = (guard == 1);
+            const Real dx = (config.mesh.xmax - config.mesh.xmin) / static_cast<Real>(num_cells);
+            config.time.final_time = static_cast<Real>(steps) * config.time.cfl * dx / Real{2.5};
+
+            Solver solver(config);
+            const double seconds = bench::time_seconds([&] { solver.run(); });
+            const double updates = static_cast<double>(solver.steps()) * static_cast<double>(num_cells);
+            best[guard] = std::max(best[guard], 1.0e-6 * updates / seconds);
+            const auto c = solver.positivity_corrections();
+            corrected[guard] = c.limited_states + c.fallback_faces;
+        }
+    }
+    std::println("{:>10} {:>12.2f} {:>12} {:>16}", "off", best[0], "-", corrected[0]);
+    std::println("{:>10} {:>12.2f} {:>11.1f}% {:>16}", "on", best[1], 100.0 * (best[0] / best[1] - 1.0), corrected[1]);
+
+    std::println("");
+    std::println("Double rarefaction (|u| = 5), 1000 cells, Superbee, HLLC, CFL 0.5");
+    std::println("{:>10} {:>10} {:>16} {:>16}", "guard", "physical", "limited states", "fallback faces");
+    for (const bool positivity : {false, true}) {
+        Solver solver(make_rarefaction_config(1000, positivity));
+        solver.run();
+
+        const auto W = solver.to_primitive();
+        const bool physical = std::all_of(W.begin(), W.end(), [](const PrimitiveVars& w) {
+            return w.rho > Real{0} && w.p > Real{0};
+        });
+        const auto c = solver.positivity_corrections();
+        std::println("{:>10} {:>10} {:>16} {:>16}", positivity ? "on" : "off", physical ? "yes" : "no",
+                     c.limited_states, c.fallback_faces);
+    }
+
+    return 0;
+}
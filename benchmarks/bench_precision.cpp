@@ -0,0 +1,60 @@
+/**
+ * @file bench_precision.cpp
+ * @brief Throughput and conservation drift for double, float and mixed precision
+ *
+ * Usage: bench_precision [num_cells] [steps] [order]
+ *
+ * Runs a Sod shock tube with periodic boundaries, so mass and energy are
+ * conserved exactly by the scheme and any drift in the totals is rounding.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <print>
+
+using namespace euler1d;
+
+namespace {
+
+template <typename T, typename Acc>
+void run_mode(const Config& config, int num_cells) {
+    using SolverType = BasicSolver<T, Acc>;
+
+    SolverType solver(config);
+    const auto initial = solver.conserved_totals();
+    const double seconds = bench::time_seconds([&] { solver.run(); });
+    const auto final_totals = solver.conserved_totals();
+
+    const double updates = static_cast<double>(solver.steps()) * static_cast<double>(num_cells);
+    const double mass_drift = std::abs(final_totals.rho - initial.rho) / std::abs(initial.rho);
+    const double energy_drift = std::abs(final_totals.E - initial.E) / std::abs(initial.E);
+
+    std::println("{:>8} {:>12.4f} {:>12.2f} {:>14.3e} {:>14.3e}",
+                 SolverType::precision_name(), seconds, 1.0e-6 * updates / seconds,
+                 mass_drift, energy_drift);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 1 << 20);
+    const int steps = bench::arg_or(argc, argv, 2, 200);
+    const int order = bench::arg_or(argc, argv, 3, 2);
+
+    auto config = bench::make_sod_config(num_cells);
+    config.numerics.order = order;
+    config.boundary.left = BoundaryType::Periodic;
+    config.boundary.right = BoundaryType::Periodic;
+    config.time.final_time = bench::sod_final_time(config, steps);
+
+    std::println("Precision modes: {} cells, ~{} SSPRK3 steps, order {}, periodic Sod", num_cells, steps, order);
+    std::println("{:>8} {:>12} {:>12} {:>14} {:>14}",
+                 "mode", "wall [s]", "Mcell/s", "mass drift", "energy drift");
+
+    run_mode<double, double>(config, num_cells);
+    run_mode<float, float>(config, num_cells);
+    run_mode<float, double>(config, num_cells);
+
+    return 0;
+}
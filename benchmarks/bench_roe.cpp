@@ -0,0 +1,129 @@
+/**
+ * @file bench_roe.cpp
+ * @brief Cost per face and accuracy per cost of Roe and HLLE against HLL and HLLC
+ *
+ * Usage: bench_roe [order] [repeats] [num_cells] [sweeps]
+ *
+ * The first table times the first-order flux loop as compute_rhs runs it,
+ * in ns per face. For Roe and HLLE it is timed twice: with the Roe averages
+ * taken per face, and with the batched passes of BasicRoeAverageCache.
+ *
+ * The second table runs the 12 test cases of data/ as configured, except for
+ * order and flux. It reports the wall time and the L1 density error against
+ * data/analytical_ref_test_case<k>.dat, interpolated to the cell centres.
+ * The cost column is error times time, which is lower for the scheme that
+ * buys accuracy more cheaply. Times are the best of `repeats` runs; test
+ * case 7 runs to t = 200 and takes most of the total.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/eos/eos.hpp"
+#include "euler1d/flux/flux.hpp"
+#include "euler1d/solver/factory.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cmath>
+#include <format>
+#include <memory>
+#include <print>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int order = bench::arg_or(argc, argv, 1, 2);
+    const int repeats = bench::arg_or(argc, argv, 2, 2);
+    const int num_cells = bench::arg_or(argc, argv, 3, 4096);
+    const int sweeps = bench::arg_or(argc, argv, 4, 2000);
+    const auto n = static_cast<std::size_t>(num_cells);
+
+    const std::pair<std::string_view, FluxScheme> schemes[] = {
+        {"hll", FluxScheme::HLL}, {"hllc", FluxScheme::HLLC}, {"hlle", FluxScheme::HLLE}, {"roe", FluxScheme::Roe},
+    };
+
+    // Flux loop cost
+    const IdealGas eos{1.4};
+    std::vector<ConservativeVars> U(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Real x = static_cast<Real>(i) / static_cast<Real>(n);
+        U[i] = eos.to_conservative(PrimitiveVars{1.0 + 0.5 * std::sin(6.0 * x), 0.8 * std::cos(4.0 * x),
+                                                 1.0 + 0.2 * std::sin(9.0 * x)});
+    }
+    std::vector<ConservativeVars> F(n - 1);
+    BasicCellCache<Real> cells;
+    cells.resize(n);
+    BasicRoeAverageCache<Real> roe;
+    roe.resize(n);
+
+    std::println("First-order flux loop: {} cells, {} sweeps", num_cells, sweeps);
+    std::println("{:>6} {:>16} {:>16}", "flux", "per face (ns)", "batched (ns)");
+    Real checksum = 0.0;
+    const double faces = static_cast<double>(sweeps) * static_cast<double>(n - 1);
+    for (const auto& [name, scheme] : schemes) {
+        const FluxVariant flux = create_flux(scheme);
+        const double face_seconds = bench::time_seconds([&] {
+            for (int s = 0; s < sweeps; ++s) {
+                cells.fill(std::span<const ConservativeVars>(U), eos);
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    F[i] = compute_flux(flux, cells(i, U[i]), cells(i + 1, U[i + 1]), eos);
+                }
+                checksum += F[n / 2].E;
+            }
+        });
+        double batched_seconds = 0.0;
+        std::visit([&](const auto& f) {
+            if constexpr (RoeAveragedFlux<std::decay_t<decltype(f)>>) {
+                batched_seconds = bench::time_seconds([&] {
+                    for (int s = 0; s < sweeps; ++s) {
+                        cells.fill(std::span<const ConservativeVars>(U), eos);
+                        roe.fill(std::span<const ConservativeVars>(U), cells, eos);
+                        for (std::size_t i = 0; i + 1 < n; ++i) {
+                            F[i] = f(cells(i, U[i]), cells(i + 1, U[i + 1]), roe(i), eos);
+                        }
+                        checksum += F[n / 2].E;
+                    }
+                });
+            }
+        }, flux);
+        std::println("{:>6} {:>16.2f} {:>16}", name, 1e9 * face_seconds / faces,
+                     batched_seconds > 0.0 ? std::format("{:.2f}", 1e9 * batched_seconds / faces) : "-");
+    }
+    std::println("checksum {:.6e}\n", checksum);
+
+    // Accuracy per cost on the test cases
+    std::println("Test cases at order {}: L1 rho error, time (s), error * time", order);
+    std::print("{:>6}", "case");
+    for (const auto& [name, scheme] : schemes) std::print(" {:>28}", name);
+    std::println("");
+    for (int k = 1; k <= 12; ++k) {
+        Config config = parse_config(std::format("data/test_case{}.toml", k));
+        config.numerics.order = order;
+        const bench::DensityReference reference(std::format("data/analytical_ref_test_case{}.dat", k));
+
+        std::print("{:>6}", k);
+        for (const auto& [name, scheme] : schemes) {
+            config.numerics.flux = scheme;
+            std::unique_ptr<Solver> solver;
+            double seconds = 0.0;
+            try {
+                for (int r = 0; r < repeats; ++r) {
+                    solver = std::make_unique<Solver>(config);
+                    const double run_seconds =
+                        bench::time_seconds([&] { solver->advance_to(config.time.final_time); });
+                    seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+                }
+            } catch (const std::exception&) {
+                std::print(" {:>28}", "failed");
+                continue;
+            }
+            const double l1 = reference.l1_error(*solver);
+            std::print(" {:>9.2e} {:>8.3f} {:>9.2e}", l1, seconds, l1 * seconds);
+        }
+        std::println("");
+    }
+
+    return 0;
+}
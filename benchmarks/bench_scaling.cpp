@@ -0,0 +1,53 @@
+/**
+ * @file bench_scaling.cpp
+ * @brief Strong scaling of the thread-per-subdomain decomposition
+ *
+ * Usage: bench_scaling [num_cells] [steps] [order] [max_ranks] [processes]
+ *
+ * Solves the same Sod problem with 1, 2, 4, ... max_ranks subdomain ranks
+ * and reports speedup and parallel efficiency relative to 1 rank. Ranks are
+ * threads, or forked processes over shared memory if `processes` is 1.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <print>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 1 << 22);
+    const int steps = bench::arg_or(argc, argv, 2, 20);
+    const int order = bench::arg_or(argc, argv, 3, 2);
+    const int max_ranks = bench::arg_or(argc, argv, 4, 64);
+    const bool processes = bench::arg_or(argc, argv, 5, 0) != 0;
+
+    std::println("Strong scaling: {} cells, ~{} SSPRK3 steps, order {}, ranks are {}",
+                 num_cells, steps, order, processes ? "processes" : "threads");
+    std::println("{:>8} {:>12} {:>12} {:>10} {:>12}", "ranks", "wall [s]", "Mcell/s", "speedup", "efficiency");
+
+    double serial_seconds = 0.0;
+    for (int ranks = 1; ranks <= max_ranks; ranks *= 2) {
+        auto config = bench::make_sod_config(num_cells);
+        config.numerics.order = order;
+        if (processes) {
+            config.execution.processes = ranks;
+        } else {
+            config.execution.threads = ranks;
+        }
+        config.time.final_time = bench::sod_final_time(config, steps);
+
+        Solver solver(config);
+        const double seconds = bench::time_seconds([&] { solver.run(); });
+        if (ranks == 1) {
+            serial_seconds = seconds;
+        }
+
+        const double updates = static_cast<double>(solver.steps()) * static_cast<double>(num_cells);
+        const double speedup = serial_seconds / seconds;
+        std::println("{:>8} {:>12.4f} {:>12.2f} {:>10.2f} {:>11.0f}%",
+                     ranks, seconds, 1.0e-6 * updates / seconds, speedup, 100.0 * speedup / ranks);
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file bench_slopes.cpp
+ * @brief MUSCL reconstruction with slopes limited per face and per cell
+ *
+ * Usage: bench_slopes [num_cells] [sweeps] [steps]
+ *
+ * For each limiter, times the reconstruction of all face states of a smooth
+ * profile with a jump, and a second-order Sod run (HLLC, SSPRK3) with each
+ * setting of NumericsConfig::slopes (best of three).
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/reconstruction/muscl.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+#include <string_view>
+#include <vector>
+
+using namespace euler1d;
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 4096);
+    const int sweeps = bench::arg_or(argc, argv, 2, 2000);
+    const int steps = bench::arg_or(argc, argv, 3, 100);
+    const auto n = static_cast<std::size_t>(num_cells);
+
+    PrimitiveArray W(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Real x = static_cast<Real>(i) / static_cast<Real>(n);
+        W[i] = PrimitiveVars{1.0 + 0.5 * std::sin(6.0 * x) + (x > 0.5 ? 1.0 : 0.0), 0.3 * std::cos(4.0 * x),
+                             1.0 + 0.2 * std::sin(9.0 * x)};
+    }
+    PrimitiveArray dW(n);
+    std::vector<std::pair<PrimitiveVars, PrimitiveVars>> faces(n);
+
+    const std::pair<std::string_view, Limiter> limiters[] = {
+        {"none", Limiter::None}, {"minmod", Limiter::Minmod}, {"vanleer", Limiter::VanLeer},
+        {"superbee", Limiter::Superbee}, {"mc", Limiter::MC},
+    };
+    const LimiterVariant variants[] = {
+        NoLimiter{}, MinmodLimiter{}, VanLeerLimiter{}, SuperbeeLimiter{}, MCLimiter{},
+    };
+
+    Config config = bench::make_sod_config(num_cells);
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    config.time.final_time = bench::sod_final_time(config, steps);
+
+    std::println("MUSCL: {} cells, {} reconstruction sweeps, ~{} SSPRK3 steps", num_cells, sweeps, steps);
+    std::println("{:>10} {:>12} {:>12} {:>9} {:>12} {:>12} {:>9}", "limiter", "face (ns)", "cell (ns)",
+                 "speedup", "face run (s)", "cell run (s)", "speedup");
+
+    const auto W_view = std::span<const PrimitiveVars>(W);
+    Real checksum = 0.0;
+    for (std::size_t j = 0; j < std::size(limiters); ++j) {
+        const auto& limiter = variants[j];
+        const double face_seconds = bench::time_seconds([&] {
+            for (int s = 0; s < sweeps; ++s) {
+                std::visit([&](const auto& lim) {
+                    for (std::size_t i = 1; i + 2 < n; ++i) {
+                        faces[i] = MUSCLReconstruction::reconstruct(W_view, static_cast<int>(i), lim);
+                    }
+                }, limiter);
+                checksum += faces[n / 2].first.rho;
+            }
+        });
+        const double cell_seconds = bench::time_seconds([&] {
+            for (int s = 0; s < sweeps; ++s) {
+                MUSCLReconstruction::limit_slopes(W_view, dW, limiter);
+                for (std::size_t i = 1; i + 2 < n; ++i) {
+                    faces[i] = MUSCLReconstruction::cell_states(W_view, std::span<const PrimitiveVars>(dW),
+                                                                static_cast<int>(i));
+                }
+                checksum += faces[n / 2].first.rho;
+            }
+        });
+
+        config.numerics.limiter = limiters[j].second;
+        double run_seconds[2] = {1e30, 1e30};  // Best of three runs
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            for (const Slopes slopes : {Slopes::Face, Slopes::Cell}) {
+                config.numerics.slopes = slopes;
+                Solver solver(config);
+                auto& best = run_seconds[slopes == Slopes::Cell];
+                best = std::min(best, bench::time_seconds([&] { solver.advance_to(config.time.final_time); }));
+                checksum += solver.solution()[n / 2].rho;
+            }
+        }
+
+        const double per_face = 1e9 / (static_cast<double>(sweeps) * static_cast<double>(n - 3));
+        std::println("{:>10} {:>12.2f} {:>12.2f} {:>8.2f}x {:>12.4f} {:>12.4f} {:>8.2f}x", limiters[j].first,
+                     face_seconds * per_face, cell_seconds * per_face, face_seconds / cell_seconds,
+                     run_seconds[0], run_seconds[1], run_seconds[0] / run_seconds[1]);
+    }
+    std::println("checksum {:.6e}", checksum);
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file bench_tiling.cpp
+ * @brief Untiled vs cache-tiled time stepping on a large Sod shock tube
+ *
+ * Usage: bench_tiling [num_cells] [steps] [order]
+ *
+ * Only time is measured. DRAM traffic is not counted (no hardware counters
+ * are read): a STREAM triad calibrates the sustained bandwidth of the
+ * machine, and the last column is the most traffic per cell-update that
+ * bandwidth allows in the measured time. It is an upper bound on the
+ * traffic, not an estimate of it.
+ */
+
+#include "bench_common.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <algorithm>
+#include <print>
+#include <vector>
+
+using namespace euler1d;
+
+namespace {
+
+/// Sustained DRAM bandwidth in bytes/s: best of five STREAM triads on 3 x 128 MiB
+double stream_triad_bandwidth() {
+    constexpr std::size_t n = std::size_t{1} << 24;
+    std::vector<double> a(n, 0.0);
+    std::vector<double> b(n, 1.0);
+    std::vector<double> c(n, 2.0);
+    double seconds = 0.0;
+    for (int r = 0; r < 5; ++r) {
+        const double run_seconds = bench::time_seconds([&] {
+            for (std::size_t i = 0; i < n; ++i) a[i] = b[i] + 3.0 * c[i];
+        });
+        seconds = (r == 0) ? run_seconds : std::min(seconds, run_seconds);
+    }
+    if (a[n / 2] != 7.0) {
+        std::println(stderr, "stream triad: unexpected result {}", a[n / 2]);
+    }
+    // STREAM convention: two reads and one write, write-allocate not counted
+    return 3.0 * static_cast<double>(n * sizeof(double)) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_cells = bench::arg_or(argc, argv, 1, 1 << 22);
+    const int steps = bench::arg_or(argc, argv, 2, 10);
+    const int order = bench::arg_or(argc, argv, 3, 1);
+
+    const std::vector<int> tile_sizes{0, 1024, 4096, 16384, 65536};
+
+    const double bandwidth = stream_triad_bandwidth();
+    std::println("Tiled time stepping: {} cells, ~{} SSPRK3 steps, order {}", num_cells, steps, order);
+    std::println("STREAM triad: {:.2f} GB/s; state {} B/cell", 1.0e-9 * bandwidth, sizeof(ConservativeVars));
+    std::println("{:>10} {:>12} {:>14} {:>20}", "tile", "wall [s]", "ns/update", "DRAM ceiling B/upd");
+
+    for (const int tile : tile_sizes) {
+        auto config = bench::make_sod_config(num_cells);
+        config.numerics.order = order;
+        config.execution.tile_cells = tile;
+        config.time.final_time = bench::sod_final_time(config, steps);
+
+        Solver solver(config);
+        const double seconds = bench::time_seconds([&] { solver.run(); });
+
+        const double updates = static_cast<double>(solver.steps()) * static_cast<double>(num_cells);
+        const double ns_per_update = 1.0e9 * seconds / updates;
+
+        std::println("{:>10} {:>12.4f} {:>14.2f} {:>20.0f}",
+                     tile == 0 ? std::string("untiled") : std::to_string(tile),
+                     seconds, ns_per_update, 1.0e-9 * bandwidth * ns_per_update);
+    }
+
+    return 0;
+}
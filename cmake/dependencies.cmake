@@ -49,3 +49,9 @@ if(EULER1D_BUILD_TESTS)
 endif()
 
 message(STATUS "Dependencies fetched successfully")
+
+# -----------------------------------------------------------------------------
+# Threads - subdomain decomposition (execution.threads)
+# -----------------------------------------------------------------------------
+
+find_package(Threads REQUIRED)
@@ -1,6 +1,9 @@
 /**
  * @file boundary.hpp
  * @brief Boundary conditions for the 1D Euler solver
+ *
+ * Boundary conditions are stateless; apply_left/apply_right are templated on
+ * the state precision, with default-precision overloads for ConservativeArray.
  */
 
 #ifndef EULER1D_BOUNDARY_BOUNDARY_HPP
@@ -23,20 +26,25 @@ namespace euler1d {
  * Copies interior values to ghost cells. Allows waves to exit cleanly.
  */
 struct TransmissiveBoundary {
-    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_left(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int first = mesh.first_interior();
         for (int i = first - 1; i >= 0; --i) {
             U[static_cast<std::size_t>(i)] = U[static_cast<std::size_t>(first)];
         }
     }
 
-    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_right(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int last = mesh.last_interior();
         const int n = mesh.total_cells();
         for (int i = last + 1; i < n; ++i) {
             U[static_cast<std::size_t>(i)] = U[static_cast<std::size_t>(last)];
         }
     }
+
+    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_left<Real>(U, mesh); }
+    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_right<Real>(U, mesh); }
 };
 
 // =============================================================================
@@ -49,7 +57,8 @@ struct TransmissiveBoundary {
  * Reflects the velocity component normal to the wall.
  */
 struct ReflectiveBoundary {
-    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_left(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int first = mesh.first_interior();
         for (int g = 0; g < Mesh1D::num_ghosts; ++g) {
             const int ghost_idx = first - 1 - g;
@@ -60,10 +69,12 @@ struct ReflectiveBoundary {
             ghost.rho = interior.rho;
             ghost.rho_u = -interior.rho_u;  // Reflect velocity
             ghost.E = interior.E;
+            ghost.rho_phi = interior.rho_phi;
         }
     }
 
-    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_right(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int last = mesh.last_interior();
         for (int g = 0; g < Mesh1D::num_ghosts; ++g) {
             const int ghost_idx = last + 1 + g;
@@ -74,8 +85,12 @@ struct ReflectiveBoundary {
             ghost.rho = interior.rho;
             ghost.rho_u = -interior.rho_u;  // Reflect velocity
             ghost.E = interior.E;
+            ghost.rho_phi = interior.rho_phi;
         }
     }
+
+    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_left<Real>(U, mesh); }
+    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_right<Real>(U, mesh); }
 };
 
 // =============================================================================
@@ -88,7 +103,8 @@ struct ReflectiveBoundary {
  * Left ghosts = right interior, right ghosts = left interior.
  */
 struct PeriodicBoundary {
-    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_left(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int first = mesh.first_interior();
         const int last = mesh.last_interior();
         for (int g = 0; g < Mesh1D::num_ghosts; ++g) {
@@ -98,7 +114,8 @@ struct PeriodicBoundary {
         }
     }
 
-    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const {
+    template <typename T>
+    void apply_right(std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) const {
         const int first = mesh.first_interior();
         const int last = mesh.last_interior();
         for (int g = 0; g < Mesh1D::num_ghosts; ++g) {
@@ -107,6 +124,9 @@ struct PeriodicBoundary {
             U[static_cast<std::size_t>(ghost_idx)] = U[static_cast<std::size_t>(source_idx)];
         }
     }
+
+    void apply_left(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_left<Real>(U, mesh); }
+    void apply_right(std::span<ConservativeVars> U, const Mesh1D& mesh) const { apply_right<Real>(U, mesh); }
 };
 
 // =============================================================================
@@ -117,22 +137,41 @@ struct PeriodicBoundary {
 using BoundaryVariant = std::variant<TransmissiveBoundary, ReflectiveBoundary, PeriodicBoundary>;
 
 /// Apply left boundary condition
-inline void apply_left_boundary(const BoundaryVariant& bc, std::span<ConservativeVars> U, const Mesh1D& mesh) {
+template <typename T>
+inline void apply_left_boundary(const BoundaryVariant& bc, std::span<BasicConservativeVars<T>> U,
+                                const Mesh1D& mesh) {
     std::visit([&](const auto& b) { b.apply_left(U, mesh); }, bc);
 }
 
 /// Apply right boundary condition
-inline void apply_right_boundary(const BoundaryVariant& bc, std::span<ConservativeVars> U, const Mesh1D& mesh) {
+template <typename T>
+inline void apply_right_boundary(const BoundaryVariant& bc, std::span<BasicConservativeVars<T>> U,
+                                 const Mesh1D& mesh) {
     std::visit([&](const auto& b) { b.apply_right(U, mesh); }, bc);
 }
 
 /// Apply both boundary conditions
+template <typename T>
 inline void apply_boundaries(const BoundaryVariant& bc_left, const BoundaryVariant& bc_right,
-                              std::span<ConservativeVars> U, const Mesh1D& mesh) {
+                             std::span<BasicConservativeVars<T>> U, const Mesh1D& mesh) {
     apply_left_boundary(bc_left, U, mesh);
     apply_right_boundary(bc_right, U, mesh);
 }
 
+/// Default-precision overloads (accept ConservativeArray directly)
+inline void apply_left_boundary(const BoundaryVariant& bc, std::span<ConservativeVars> U, const Mesh1D& mesh) {
+    apply_left_boundary<Real>(bc, U, mesh);
+}
+
+inline void apply_right_boundary(const BoundaryVariant& bc, std::span<ConservativeVars> U, const Mesh1D& mesh) {
+    apply_right_boundary<Real>(bc, U, mesh);
+}
+
+inline void apply_boundaries(const BoundaryVariant& bc_left, const BoundaryVariant& bc_right,
+                             std::span<ConservativeVars> U, const Mesh1D& mesh) {
+    apply_boundaries<Real>(bc_left, bc_right, U, mesh);
+}
+
 }  // namespace euler1d
 
 #endif  // EULER1D_BOUNDARY_BOUNDARY_HPP
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <type_traits>
 
 namespace euler1d {
 
@@ -25,7 +26,14 @@ enum class FluxScheme {
     Rusanov,  ///< Rusanov (identical to LLF for scalar max wavespeed)
     HLL,      ///< Harten-Lax-van Leer
     HLLC,     ///< HLL with Contact restoration
-    MoversLE  ///< MoversLE flux with adaptive dissipation
+    MoversLE,       ///< MoversLE flux with adaptive dissipation
+    StegerWarming,  ///< Steger-Warming flux vector splitting
+    VanLeer,        ///< Van Leer flux vector splitting
+    AUSMPlus,       ///< AUSM+ (advection upstream splitting)
+    AUSMPlusUp,     ///< AUSM+-up (AUSM+ with pressure and velocity diffusion)
+    Roe,            ///< Roe with the Harten-Hyman entropy fix
+    HLLE,           ///< HLL with Einfeldt wave speeds
+    KurganovTadmor  ///< Central-upwind flux (identical to HLL with Davis speeds)
 };
 
 /// Available slope limiters for MUSCL reconstruction
@@ -37,10 +45,26 @@ enum class Limiter {
     MC         ///< Monotonized Central limiter
 };
 
+/// How often MUSCL limits the slope of a cell
+enum class Slopes {
+    Cell,  ///< Once per cell, into a slope buffer shared by both faces
+    Face   ///< Once per face, so every cell twice
+};
+
 /// Available time integration schemes
 enum class TimeIntegrator {
     ExplicitEuler,  ///< Forward Euler (first order)
-    SSPRK3          ///< Strong Stability Preserving RK3 (third order)
+    SSPRK3,         ///< Strong Stability Preserving RK3 (third order)
+    MUSCLHancock,   ///< MUSCL-Hancock predictor-corrector (second order, one flux evaluation)
+    ADER,           ///< ADER with a space-time predictor (third order, one flux evaluation)
+    BackwardEuler,  ///< Linearized backward Euler (implicit, first order)
+    BDF2            ///< Linearized variable-step BDF2 (implicit)
+};
+
+/// Linear solvers for the block-tridiagonal systems of implicit integrators
+enum class LinearSolver {
+    Thomas,  ///< Block Thomas algorithm (sequential, O(n))
+    PCR      ///< Parallel cyclic reduction over ExecutionConfig::threads
 };
 
 /// Available boundary condition types
@@ -55,12 +79,33 @@ enum class EosModel {
     IdealGas  ///< Ideal gas with constant gamma
 };
 
+/// Floating-point precision of the solver kernels
+enum class Precision {
+    Double,  ///< Store and compute in double
+    Float,   ///< Store and compute in float
+    Mixed    ///< Store state in float, accumulate fluxes and sums in double
+};
+
 /// Available initial condition types
 enum class InitialConditionType {
     PiecewiseConstant,        ///< Multiple constant regions
     ShockEntropyInteraction   ///< Shock + sinusoidal entropy wave
 };
 
+/// Available source terms
+enum class SourceType {
+    None,       ///< Homogeneous Euler equations
+    Geometric,  ///< Cross-section A(x): quasi-1D nozzle, cylindrical or spherical symmetry
+    Gravity,    ///< Constant body force
+    Reaction    ///< One-step Arrhenius reaction consuming passive scalar 0
+};
+
+/// Coupling of the source term to the flux update
+enum class SourceCoupling {
+    Explicit,  ///< S(U) added to the right-hand side of every RK stage
+    Strang     ///< Half-step source integration before and after the flux step
+};
+
 // =============================================================================
 // Configuration Structures
 // =============================================================================
@@ -76,6 +121,7 @@ struct MeshConfig {
     Real xmin = 0.0;
     Real xmax = 1.0;
     int num_cells = 100;
+    bool expand = false;  ///< Start from a window around the initial discontinuities and grow it with the waves
 };
 
 /// Time stepping configuration
@@ -83,6 +129,8 @@ struct TimeConfig {
     Real cfl = 0.5;
     Real final_time = 1.0;
     TimeIntegrator integrator = TimeIntegrator::SSPRK3;
+    int max_retries = 3;  ///< Rollbacks with halved CFL after a non-physical state (0 = abort at once)
+    LinearSolver linear_solver = LinearSolver::Thomas;  ///< For BackwardEuler and BDF2
 };
 
 /// Numerical scheme configuration
@@ -90,6 +138,22 @@ struct NumericsConfig {
     int order = 1;  ///< 1 = first order, 2 = second order (MUSCL)
     FluxScheme flux = FluxScheme::LLF;
     Limiter limiter = Limiter::VanLeer;
+    Slopes slopes = Slopes::Cell;
+    bool positivity = true;  ///< Positivity-preserving slope scaling and flux fallback (order 2)
+    bool hybrid_flux = false;      ///< LLF at faces the shock sensor leaves unflagged, the configured flux elsewhere
+    Real sensor_threshold = 0.02;  ///< Relative jump of rho or p across a face that flags it (hybrid_flux)
+};
+
+/// Execution (performance) configuration
+struct ExecutionConfig {
+    int tile_cells = 0;  ///< Interior cells per cache tile (0 = untiled)
+    int threads = 1;     ///< Subdomain threads (0 = hardware concurrency)
+    int processes = 1;   ///< Subdomain processes sharing memory (used instead of threads when > 1)
+    bool rank_output = false;  ///< Each rank also writes its own subdomain to <test_name>_rank<k>.csv
+    Precision precision = std::is_same_v<Real, float> ? Precision::Float : Precision::Double;
+    HugePages huge_pages = HugePages::None;  ///< Page backing of the solver's own arena (None: heap unless first_touch)
+    bool first_touch = false;  ///< Solution arrays are faulted in by one thread per subdomain
+    bool active_regions = false;  ///< Step only the cells near non-uniform data (serial, untiled, no source)
 };
 
 /// Equation of state configuration
@@ -104,6 +168,26 @@ struct BoundaryConfig {
     BoundaryType right = BoundaryType::Transmissive;
 };
 
+/// Source term configuration
+struct SourceConfig {
+    SourceType type = SourceType::None;
+    SourceCoupling coupling = SourceCoupling::Explicit;
+    std::vector<Real> area{1.0};        ///< Geometric: A(x) = area[0] + area[1]*x + area[2]*x^2 + ...
+    Real gravity = 0.0;                 ///< Gravity: acceleration along +x
+    Real rate_constant = 0.0;           ///< Reaction: K in omega = K*rho*Y*exp(-T_a / (p/rho))
+    Real activation_temperature = 0.0;  ///< Reaction: T_a
+    Real heat_release = 0.0;            ///< Reaction: energy released per unit mass of reactant
+};
+
+/// Steady-state mode: iterate until the residual has dropped instead of to final_time
+struct SteadyConfig {
+    bool enabled = false;
+    Real tolerance = 1e-8;              ///< Stop when the residual has dropped by this factor from its peak
+    int max_iterations = 100000;        ///< Stop unconverged after this many iterations
+    bool local_time_stepping = false;   ///< Every cell steps at its own CFL limit (explicit integrators)
+    int multigrid_levels = 1;           ///< FAS multigrid levels, including the finest (1 = single grid)
+};
+
 /// A constant region for piecewise initial conditions
 struct Region {
     Real x_left = 0.0;
@@ -111,6 +195,7 @@ struct Region {
     Real rho = 1.0;
     Real u = 0.0;
     Real p = 1.0;
+    std::vector<Real> scalars;  ///< Passive scalars phi_k (num_scalars entries, or empty for zero)
 };
 
 /// State for shock-entropy interaction (constant part)
@@ -149,9 +234,12 @@ struct Config {
     MeshConfig mesh;
     TimeConfig time;
     NumericsConfig numerics;
+    ExecutionConfig execution;
     EosConfig eos;
     BoundaryConfig boundary;
     InitialConditionConfig initial_condition;
+    SourceConfig source;
+    SteadyConfig steady;
 };
 
 // =============================================================================
@@ -164,18 +252,36 @@ FluxScheme parse_flux_scheme(const std::string& str);
 /// Convert string to Limiter
 Limiter parse_limiter(const std::string& str);
 
+/// Convert string to Slopes
+Slopes parse_slopes(const std::string& str);
+
 /// Convert string to TimeIntegrator
 TimeIntegrator parse_time_integrator(const std::string& str);
 
+/// Convert string to LinearSolver
+LinearSolver parse_linear_solver(const std::string& str);
+
 /// Convert string to BoundaryType
 BoundaryType parse_boundary_type(const std::string& str);
 
 /// Convert string to EosModel
 EosModel parse_eos_model(const std::string& str);
 
+/// Convert string to Precision
+Precision parse_precision(const std::string& str);
+
+/// Convert string to HugePages
+HugePages parse_huge_pages(const std::string& str);
+
 /// Convert string to InitialConditionType
 InitialConditionType parse_initial_condition_type(const std::string& str);
 
+/// Convert string to SourceType
+SourceType parse_source_type(const std::string& str);
+
+/// Convert string to SourceCoupling
+SourceCoupling parse_source_coupling(const std::string& str);
+
 }  // namespace euler1d
 
 #endif  // EULER1D_CONFIG_CONFIG_TYPES_HPP
@@ -27,6 +27,16 @@ public:
  */
 Config parse_config(const std::filesystem::path& path);
 
+/**
+ * @brief Check that a configuration with MeshConfig::expand can grow its window
+ *
+ * Called by parse_config and by the solver constructor, so that configs built
+ * in code are checked as well. A no-op without expand.
+ *
+ * @throws ConfigError if an option needs the whole domain from the start
+ */
+void validate_expand(const Config& config);
+
 }  // namespace euler1d
 
 #endif  // EULER1D_CONFIG_PARSER_HPP
@@ -31,16 +31,25 @@ struct PrecisionTraits<float> {
 };
 
 /// Small number to avoid division by zero
-inline constexpr Real epsilon = PrecisionTraits<Real>::epsilon;
+template <typename T>
+inline constexpr T epsilon_v = PrecisionTraits<T>::epsilon;
+
+inline constexpr Real epsilon = epsilon_v<Real>;
 
 /// Default gamma for ideal gas (air at standard conditions)
 inline constexpr Real default_gamma = static_cast<Real>(1.4);
 
 /// Minimum allowed density
-inline constexpr Real min_density = PrecisionTraits<Real>::min_value;
+template <typename T>
+inline constexpr T min_density_v = PrecisionTraits<T>::min_value;
+
+inline constexpr Real min_density = min_density_v<Real>;
 
 /// Minimum allowed pressure
-inline constexpr Real min_pressure = PrecisionTraits<Real>::min_value;
+template <typename T>
+inline constexpr T min_pressure_v = PrecisionTraits<T>::min_value;
+
+inline constexpr Real min_pressure = min_pressure_v<Real>;
 
 }  // namespace constants
 
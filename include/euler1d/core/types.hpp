@@ -3,23 +3,39 @@
  * @brief Core type definitions for the 1D Euler solver
  *
  * Defines the fundamental types used throughout the solver:
- * - Real: compile-time selectable precision (float/double)
- * - ConservativeVars: conserved variables (rho, rho*u, E)
- * - PrimitiveVars: primitive variables (rho, u, p)
+ * - Real: default precision (float/double), selected at build time
+ * - BasicConservativeVars<T, N>: conserved variables (rho, rho*u, E, rho*phi_k)
+ * - BasicPrimitiveVars<T, N>: primitive variables (rho, u, p, phi_k)
+ *
+ * The state types are templated on their floating-point type so float and
+ * double kernels can live in the same binary, and on their component count
+ * N: the three Euler components followed by N - 3 passive scalars phi_k
+ * (species mass fractions, tracers) advected with the flow. N defaults to
+ * num_components, fixed at build time by EULER1D_NUM_SCALARS. With no
+ * scalars the states hold exactly the three Euler components, with the same
+ * layout and operations as a plain (rho, rho*u, E) struct.
+ *
+ * ConservativeVars and PrimitiveVars are the Real, num_components
+ * instantiations.
  */
 
 #ifndef EULER1D_CORE_TYPES_HPP
 #define EULER1D_CORE_TYPES_HPP
 
+#include "../memory/arena.hpp"
 #include <array>
+#include <bit>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 namespace euler1d {
 
 // =============================================================================
-// Compile-time precision selection
+// Default precision selection
 // =============================================================================
 
 // Use token pasting to check precision
@@ -35,6 +51,34 @@ namespace euler1d {
     using Real = double;
 #endif
 
+// =============================================================================
+// Component count (species transport mode)
+// =============================================================================
+
+#ifndef EULER1D_NUM_SCALARS
+#define EULER1D_NUM_SCALARS 0
+#endif
+
+static_assert(EULER1D_NUM_SCALARS >= 0, "EULER1D_NUM_SCALARS must be non-negative");
+
+/// Passive scalars transported by the solver (0 = plain Euler)
+inline constexpr std::size_t num_scalars = EULER1D_NUM_SCALARS;
+
+/// Components of the solver state: rho, rho*u, E and the passive scalars
+inline constexpr std::size_t num_components = 3 + num_scalars;
+
+/// Storage for the passive scalars of a state; empty when there are none
+struct NoScalars {};
+
+template <typename T, std::size_t M>
+using PassiveScalars = std::conditional_t<M == 0, NoScalars, std::array<T, M>>;
+
+#if defined(_MSC_VER)
+#define EULER1D_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define EULER1D_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 // =============================================================================
 // Conservative Variables: (rho, rho*u, E)
 // =============================================================================
@@ -45,60 +89,95 @@ namespace euler1d {
  * The 1D Euler equations in conservative form:
  *   ∂U/∂t + ∂F(U)/∂x = 0
  *
- * where U = (ρ, ρu, E)^T
+ * where U = (ρ, ρu, E, ρφ_1, ..., ρφ_{N-3})^T
  */
-struct ConservativeVars {
-    Real rho;    ///< Density
-    Real rho_u;  ///< Momentum (density * velocity)
-    Real E;      ///< Total energy per unit volume
+template <typename T, std::size_t N = num_components>
+struct BasicConservativeVars {
+    static_assert(N >= 3, "A state has at least the three Euler components");
+
+    using value_type = T;
+    using Scalars = PassiveScalars<T, N - 3>;
+
+    T rho;    ///< Density
+    T rho_u;  ///< Momentum (density * velocity)
+    T E;      ///< Total energy per unit volume
+    EULER1D_NO_UNIQUE_ADDRESS Scalars rho_phi{};  ///< Partial densities rho*phi_k of the passive scalars
 
     /// Default constructor (zero initialization)
-    constexpr ConservativeVars() noexcept : rho{0}, rho_u{0}, E{0} {}
+    constexpr BasicConservativeVars() noexcept : rho{0}, rho_u{0}, E{0} {}
 
-    /// Value constructor
-    constexpr ConservativeVars(Real rho_, Real rho_u_, Real E_) noexcept
+    /// Value constructor (passive scalars zero)
+    constexpr BasicConservativeVars(T rho_, T rho_u_, T E_) noexcept
         : rho{rho_}, rho_u{rho_u_}, E{E_} {}
 
+    /// Value constructor including the passive scalars
+    constexpr BasicConservativeVars(T rho_, T rho_u_, T E_, const Scalars& rho_phi_) noexcept
+        requires (N > 3)
+        : rho{rho_}, rho_u{rho_u_}, E{E_}, rho_phi{rho_phi_} {}
+
+    /// Precision conversion
+    template <typename U>
+    explicit constexpr BasicConservativeVars(const BasicConservativeVars<U, N>& other) noexcept
+        : rho{static_cast<T>(other.rho)}, rho_u{static_cast<T>(other.rho_u)}, E{static_cast<T>(other.E)} {
+        for_each_scalar([&](auto k) { rho_phi[k] = static_cast<T>(other.rho_phi[k]); });
+    }
+
     /// Arithmetic operations
-    constexpr ConservativeVars operator+(const ConservativeVars& other) const noexcept {
-        return {rho + other.rho, rho_u + other.rho_u, E + other.E};
+    constexpr BasicConservativeVars operator+(const BasicConservativeVars& other) const noexcept {
+        BasicConservativeVars result{rho + other.rho, rho_u + other.rho_u, E + other.E};
+        for_each_scalar([&](auto k) { result.rho_phi[k] = rho_phi[k] + other.rho_phi[k]; });
+        return result;
     }
 
-    constexpr ConservativeVars operator-(const ConservativeVars& other) const noexcept {
-        return {rho - other.rho, rho_u - other.rho_u, E - other.E};
+    constexpr BasicConservativeVars operator-(const BasicConservativeVars& other) const noexcept {
+        BasicConservativeVars result{rho - other.rho, rho_u - other.rho_u, E - other.E};
+        for_each_scalar([&](auto k) { result.rho_phi[k] = rho_phi[k] - other.rho_phi[k]; });
+        return result;
     }
 
-    constexpr ConservativeVars operator*(Real scalar) const noexcept {
-        return {rho * scalar, rho_u * scalar, E * scalar};
+    constexpr BasicConservativeVars operator*(T scalar) const noexcept {
+        BasicConservativeVars result{rho * scalar, rho_u * scalar, E * scalar};
+        for_each_scalar([&](auto k) { result.rho_phi[k] = rho_phi[k] * scalar; });
+        return result;
     }
 
-    constexpr ConservativeVars operator/(Real scalar) const noexcept {
-        return {rho / scalar, rho_u / scalar, E / scalar};
+    constexpr BasicConservativeVars operator/(T scalar) const noexcept {
+        BasicConservativeVars result{rho / scalar, rho_u / scalar, E / scalar};
+        for_each_scalar([&](auto k) { result.rho_phi[k] = rho_phi[k] / scalar; });
+        return result;
     }
 
-    constexpr ConservativeVars& operator+=(const ConservativeVars& other) noexcept {
+    constexpr BasicConservativeVars& operator+=(const BasicConservativeVars& other) noexcept {
         rho += other.rho;
         rho_u += other.rho_u;
         E += other.E;
+        for_each_scalar([&](auto k) { rho_phi[k] += other.rho_phi[k]; });
         return *this;
     }
 
-    constexpr ConservativeVars& operator-=(const ConservativeVars& other) noexcept {
+    constexpr BasicConservativeVars& operator-=(const BasicConservativeVars& other) noexcept {
         rho -= other.rho;
         rho_u -= other.rho_u;
         E -= other.E;
+        for_each_scalar([&](auto k) { rho_phi[k] -= other.rho_phi[k]; });
         return *this;
     }
 
-    constexpr ConservativeVars& operator*=(Real scalar) noexcept {
+    constexpr BasicConservativeVars& operator*=(T scalar) noexcept {
         rho *= scalar;
         rho_u *= scalar;
         E *= scalar;
+        for_each_scalar([&](auto k) { rho_phi[k] *= scalar; });
         return *this;
     }
 
-    /// Access by index (0=rho, 1=rho_u, 2=E)
-    constexpr Real& operator[](std::size_t i) noexcept {
+    /// Access by index (0=rho, 1=rho_u, 2=E, 3+k=rho_phi[k])
+    constexpr T& operator[](std::size_t i) noexcept {
+        if constexpr (N > 3) {
+            if (i >= 3) {
+                return rho_phi[i - 3];
+            }
+        }
         switch (i) {
             case 0: return rho;
             case 1: return rho_u;
@@ -106,7 +185,12 @@ struct ConservativeVars {
         }
     }
 
-    constexpr const Real& operator[](std::size_t i) const noexcept {
+    constexpr const T& operator[](std::size_t i) const noexcept {
+        if constexpr (N > 3) {
+            if (i >= 3) {
+                return rho_phi[i - 3];
+            }
+        }
         switch (i) {
             case 0: return rho;
             case 1: return rho_u;
@@ -115,14 +199,33 @@ struct ConservativeVars {
     }
 
     /// Number of components
-    static constexpr std::size_t size() noexcept { return 3; }
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /**
+     * @brief Call f(k) for each passive scalar index k
+     *
+     * f should take `auto k`: without scalars it is never instantiated, so
+     * its body may index rho_phi/phi, and the call compiles to nothing.
+     */
+    template <typename F>
+    static constexpr void for_each_scalar(F&& f) {
+        if constexpr (N > 3) {
+            for (std::size_t k = 0; k < N - 3; ++k) {
+                f(k);
+            }
+        }
+    }
 };
 
 /// Scalar multiplication (scalar * vars)
-constexpr ConservativeVars operator*(Real scalar, const ConservativeVars& vars) noexcept {
+template <typename T, std::size_t N>
+constexpr BasicConservativeVars<T, N> operator*(T scalar, const BasicConservativeVars<T, N>& vars) noexcept {
     return vars * scalar;
 }
 
+/// State type in the default precision
+using ConservativeVars = BasicConservativeVars<Real>;
+
 // =============================================================================
 // Primitive Variables: (rho, u, p)
 // =============================================================================
@@ -130,61 +233,96 @@ constexpr ConservativeVars operator*(Real scalar, const ConservativeVars& vars)
 /**
  * @brief Primitive variables for the 1D Euler equations
  *
- * Primitive form: (ρ, u, p)^T
+ * Primitive form: (ρ, u, p, φ_1, ..., φ_{N-3})^T
  * More intuitive and often used for reconstruction
  */
-struct PrimitiveVars {
-    Real rho;  ///< Density
-    Real u;    ///< Velocity
-    Real p;    ///< Pressure
+template <typename T, std::size_t N = num_components>
+struct BasicPrimitiveVars {
+    static_assert(N >= 3, "A state has at least the three Euler components");
+
+    using value_type = T;
+    using Scalars = PassiveScalars<T, N - 3>;
+
+    T rho;  ///< Density
+    T u;    ///< Velocity
+    T p;    ///< Pressure
+    EULER1D_NO_UNIQUE_ADDRESS Scalars phi{};  ///< Passive scalars per unit mass (e.g. mass fractions)
 
     /// Default constructor (zero initialization)
-    constexpr PrimitiveVars() noexcept : rho{0}, u{0}, p{0} {}
+    constexpr BasicPrimitiveVars() noexcept : rho{0}, u{0}, p{0} {}
 
-    /// Value constructor
-    constexpr PrimitiveVars(Real rho_, Real u_, Real p_) noexcept
+    /// Value constructor (passive scalars zero)
+    constexpr BasicPrimitiveVars(T rho_, T u_, T p_) noexcept
         : rho{rho_}, u{u_}, p{p_} {}
 
+    /// Value constructor including the passive scalars
+    constexpr BasicPrimitiveVars(T rho_, T u_, T p_, const Scalars& phi_) noexcept
+        requires (N > 3)
+        : rho{rho_}, u{u_}, p{p_}, phi{phi_} {}
+
+    /// Precision conversion
+    template <typename U>
+    explicit constexpr BasicPrimitiveVars(const BasicPrimitiveVars<U, N>& other) noexcept
+        : rho{static_cast<T>(other.rho)}, u{static_cast<T>(other.u)}, p{static_cast<T>(other.p)} {
+        for_each_scalar([&](auto k) { phi[k] = static_cast<T>(other.phi[k]); });
+    }
+
     /// Arithmetic operations
-    constexpr PrimitiveVars operator+(const PrimitiveVars& other) const noexcept {
-        return {rho + other.rho, u + other.u, p + other.p};
+    constexpr BasicPrimitiveVars operator+(const BasicPrimitiveVars& other) const noexcept {
+        BasicPrimitiveVars result{rho + other.rho, u + other.u, p + other.p};
+        for_each_scalar([&](auto k) { result.phi[k] = phi[k] + other.phi[k]; });
+        return result;
     }
 
-    constexpr PrimitiveVars operator-(const PrimitiveVars& other) const noexcept {
-        return {rho - other.rho, u - other.u, p - other.p};
+    constexpr BasicPrimitiveVars operator-(const BasicPrimitiveVars& other) const noexcept {
+        BasicPrimitiveVars result{rho - other.rho, u - other.u, p - other.p};
+        for_each_scalar([&](auto k) { result.phi[k] = phi[k] - other.phi[k]; });
+        return result;
     }
 
-    constexpr PrimitiveVars operator*(Real scalar) const noexcept {
-        return {rho * scalar, u * scalar, p * scalar};
+    constexpr BasicPrimitiveVars operator*(T scalar) const noexcept {
+        BasicPrimitiveVars result{rho * scalar, u * scalar, p * scalar};
+        for_each_scalar([&](auto k) { result.phi[k] = phi[k] * scalar; });
+        return result;
     }
 
-    constexpr PrimitiveVars operator/(Real scalar) const noexcept {
-        return {rho / scalar, u / scalar, p / scalar};
+    constexpr BasicPrimitiveVars operator/(T scalar) const noexcept {
+        BasicPrimitiveVars result{rho / scalar, u / scalar, p / scalar};
+        for_each_scalar([&](auto k) { result.phi[k] = phi[k] / scalar; });
+        return result;
     }
 
-    constexpr PrimitiveVars& operator+=(const PrimitiveVars& other) noexcept {
+    constexpr BasicPrimitiveVars& operator+=(const BasicPrimitiveVars& other) noexcept {
         rho += other.rho;
         u += other.u;
         p += other.p;
+        for_each_scalar([&](auto k) { phi[k] += other.phi[k]; });
         return *this;
     }
 
-    constexpr PrimitiveVars& operator-=(const PrimitiveVars& other) noexcept {
+    constexpr BasicPrimitiveVars& operator-=(const BasicPrimitiveVars& other) noexcept {
         rho -= other.rho;
         u -= other.u;
         p -= other.p;
+        for_each_scalar([&](auto k) { phi[k] -= other.phi[k]; });
         return *this;
     }
 
-    constexpr PrimitiveVars& operator*=(Real scalar) noexcept {
+    constexpr BasicPrimitiveVars& operator*=(T scalar) noexcept {
         rho *= scalar;
         u *= scalar;
         p *= scalar;
+        for_each_scalar([&](auto k) { phi[k] *= scalar; });
         return *this;
     }
 
-    /// Access by index (0=rho, 1=u, 2=p)
-    constexpr Real& operator[](std::size_t i) noexcept {
+    /// Access by index (0=rho, 1=u, 2=p, 3+k=phi[k])
+    constexpr T& operator[](std::size_t i) noexcept {
+        if constexpr (N > 3) {
+            if (i >= 3) {
+                return phi[i - 3];
+            }
+        }
         switch (i) {
             case 0: return rho;
             case 1: return u;
@@ -192,7 +330,12 @@ struct PrimitiveVars {
         }
     }
 
-    constexpr const Real& operator[](std::size_t i) const noexcept {
+    constexpr const T& operator[](std::size_t i) const noexcept {
+        if constexpr (N > 3) {
+            if (i >= 3) {
+                return phi[i - 3];
+            }
+        }
         switch (i) {
             case 0: return rho;
             case 1: return u;
@@ -201,23 +344,106 @@ struct PrimitiveVars {
     }
 
     /// Number of components
-    static constexpr std::size_t size() noexcept { return 3; }
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /**
+     * @brief Call f(k) for each passive scalar index k
+     *
+     * f should take `auto k`: without scalars it is never instantiated, so
+     * its body may index rho_phi/phi, and the call compiles to nothing.
+     */
+    template <typename F>
+    static constexpr void for_each_scalar(F&& f) {
+        if constexpr (N > 3) {
+            for (std::size_t k = 0; k < N - 3; ++k) {
+                f(k);
+            }
+        }
+    }
 };
 
 /// Scalar multiplication (scalar * vars)
-constexpr PrimitiveVars operator*(Real scalar, const PrimitiveVars& vars) noexcept {
+template <typename T, std::size_t N>
+constexpr BasicPrimitiveVars<T, N> operator*(T scalar, const BasicPrimitiveVars<T, N>& vars) noexcept {
     return vars * scalar;
 }
 
+/// State type in the default precision
+using PrimitiveVars = BasicPrimitiveVars<Real>;
+
 // =============================================================================
 // Type aliases for solution arrays
 // =============================================================================
 
-/// Array of conservative variables (one per cell including ghosts)
-using ConservativeArray = std::vector<ConservativeVars>;
+/// Array of conservative variables (one per cell including ghosts), 64-byte aligned
+template <typename T>
+using BasicConservativeArray = ArenaVector<BasicConservativeVars<T>>;
 
 /// Array of primitive variables
-using PrimitiveArray = std::vector<PrimitiveVars>;
+template <typename T>
+using BasicPrimitiveArray = ArenaVector<BasicPrimitiveVars<T>>;
+
+using ConservativeArray = BasicConservativeArray<Real>;
+using PrimitiveArray = BasicPrimitiveArray<Real>;
+
+// The plain Euler states are three packed components, as handed out by the C API
+static_assert(sizeof(BasicConservativeVars<double, 3>) == 3 * sizeof(double) &&
+              sizeof(BasicPrimitiveVars<float, 3>) == 3 * sizeof(float));
+
+/// Convert a state to another precision (no-op when the types match)
+template <typename To, typename T, std::size_t N>
+[[nodiscard]] constexpr auto precision_cast(const BasicConservativeVars<T, N>& s) noexcept {
+    if constexpr (std::is_same_v<T, To>) {
+        return s;
+    } else {
+        return BasicConservativeVars<To, N>(s);
+    }
+}
+
+/// Convert a state to another precision (no-op when the types match)
+template <typename To, typename T, std::size_t N>
+[[nodiscard]] constexpr auto precision_cast(const BasicPrimitiveVars<T, N>& s) noexcept {
+    if constexpr (std::is_same_v<T, To>) {
+        return s;
+    } else {
+        return BasicPrimitiveVars<To, N>(s);
+    }
+}
+
+/// Add the square of each component of U to the matching component of sum
+template <typename T, std::size_t N>
+constexpr void accumulate_squares(BasicConservativeVars<T, N>& sum, const BasicConservativeVars<T, N>& U) noexcept {
+    for (std::size_t k = 0; k < N; ++k) {
+        sum[k] += U[k] * U[k];
+    }
+}
+
+/**
+ * @brief Whether x is neither NaN nor infinite, tested on its exponent bits
+ *
+ * Unlike std::isfinite this survives -ffast-math, under which the compiler
+ * may assume non-finite values never occur and fold the test away.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr bool is_finite_bits(T x) noexcept {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "IEEE binary32/binary64 expected");
+    if constexpr (sizeof(T) == 8) {
+        constexpr std::uint64_t exponent = 0x7ff0000000000000ULL;
+        return (std::bit_cast<std::uint64_t>(x) & exponent) != exponent;
+    } else {
+        constexpr std::uint32_t exponent = 0x7f800000U;
+        return (std::bit_cast<std::uint32_t>(x) & exponent) != exponent;
+    }
+}
+
+/// Whether every component of U is finite (see is_finite_bits)
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr bool is_finite_bits(const BasicConservativeVars<T, N>& U) noexcept {
+    // Bitwise & keeps loops over states branch-free
+    bool finite = is_finite_bits(U.rho) & is_finite_bits(U.rho_u) & is_finite_bits(U.E);
+    U.for_each_scalar([&](auto k) { finite = finite & is_finite_bits(U.rho_phi[k]); });
+    return finite;
+}
 
 }  // namespace euler1d
 
@@ -11,6 +11,7 @@
 
 #include "../core/types.hpp"
 #include "../core/constants.hpp"
+#include <array>
 #include <cmath>
 #include <variant>
 
@@ -25,135 +26,218 @@ namespace euler1d {
  *
  * p = (γ - 1) * ρ * e
  * where e is the specific internal energy
+ *
+ * Passive scalars do not enter the pressure; they are carried through the
+ * conversions (ρφ_k <-> φ_k) and advected by the flux (ρφ_k u).
+ *
+ * @tparam T Floating-point type of the states it operates on
  */
-struct IdealGas {
-    Real gamma;  ///< Ratio of specific heats (Cp/Cv)
+template <typename T>
+struct BasicIdealGas {
+    using value_type = T;
+    template <std::size_t N>
+    using Conservative = BasicConservativeVars<T, N>;
+    template <std::size_t N>
+    using Primitive = BasicPrimitiveVars<T, N>;
+
+    T gamma;  ///< Ratio of specific heats (Cp/Cv)
 
     /// Construct with given gamma
-    explicit constexpr IdealGas(Real gamma_ = constants::default_gamma) noexcept
+    explicit constexpr BasicIdealGas(T gamma_ = static_cast<T>(constants::default_gamma)) noexcept
         : gamma{gamma_} {}
 
     /// Compute pressure from conservative variables
-    [[nodiscard]] constexpr Real pressure(const ConservativeVars& U) const noexcept {
-        const Real rho = U.rho;
-        const Real u = U.rho_u / rho;
-        const Real kinetic = Real{0.5} * rho * u * u;
-        const Real internal = U.E - kinetic;
-        return (gamma - Real{1}) * internal;
+    template <std::size_t N>
+    [[nodiscard]] constexpr T pressure(const Conservative<N>& U) const noexcept {
+        const T rho = U.rho;
+        const T u = U.rho_u / rho;
+        const T kinetic = T{0.5} * rho * u * u;
+        const T internal = U.E - kinetic;
+        return (gamma - T{1}) * internal;
+    }
+
+    /// Whether U has positive density and pressure (the admissible set is convex)
+    template <std::size_t N>
+    [[nodiscard]] constexpr bool is_admissible(const Conservative<N>& U) const noexcept {
+        // p > p_min multiplied through by rho > 0, which avoids the division
+        return U.rho > constants::min_density_v<T> &&
+               (gamma - T{1}) * (U.rho * U.E - T{0.5} * U.rho_u * U.rho_u) > constants::min_pressure_v<T> * U.rho;
     }
 
     /// Compute pressure from density and internal energy
-    [[nodiscard]] constexpr Real pressure(Real rho, Real e_internal) const noexcept {
-        return (gamma - Real{1}) * rho * e_internal;
+    [[nodiscard]] constexpr T pressure(T rho, T e_internal) const noexcept {
+        return (gamma - T{1}) * rho * e_internal;
     }
 
     /// Compute sound speed from density and pressure
-    [[nodiscard]] Real sound_speed(Real rho, Real p) const noexcept {
+    [[nodiscard]] T sound_speed(T rho, T p) const noexcept {
         return std::sqrt(gamma * p / rho);
     }
 
     /// Compute sound speed from conservative variables
-    [[nodiscard]] Real sound_speed(const ConservativeVars& U) const noexcept {
+    template <std::size_t N>
+    [[nodiscard]] T sound_speed(const Conservative<N>& U) const noexcept {
         return sound_speed(U.rho, pressure(U));
     }
 
     /// Compute specific internal energy from pressure and density
-    [[nodiscard]] constexpr Real internal_energy(Real rho, Real p) const noexcept {
-        return p / ((gamma - Real{1}) * rho);
+    [[nodiscard]] constexpr T internal_energy(T rho, T p) const noexcept {
+        return p / ((gamma - T{1}) * rho);
     }
 
     /// Compute total energy from primitive variables
-    [[nodiscard]] constexpr Real total_energy(const PrimitiveVars& W) const noexcept {
-        const Real e_internal = internal_energy(W.rho, W.p);
-        const Real e_kinetic = Real{0.5} * W.u * W.u;
+    template <std::size_t N>
+    [[nodiscard]] constexpr T total_energy(const Primitive<N>& W) const noexcept {
+        const T e_internal = internal_energy(W.rho, W.p);
+        const T e_kinetic = T{0.5} * W.u * W.u;
         return W.rho * (e_internal + e_kinetic);
     }
 
     /// Compute specific enthalpy h = e + p/rho = (E + p)/rho
-    [[nodiscard]] constexpr Real enthalpy(const ConservativeVars& U) const noexcept {
-        const Real p = pressure(U);
+    template <std::size_t N>
+    [[nodiscard]] constexpr T enthalpy(const Conservative<N>& U) const noexcept {
+        const T p = pressure(U);
         return (U.E + p) / U.rho;
     }
 
     /// Compute specific enthalpy from primitive variables
-    [[nodiscard]] constexpr Real enthalpy(const PrimitiveVars& W) const noexcept {
-        const Real e_int = internal_energy(W.rho, W.p);
-        return e_int + Real{0.5} * W.u * W.u + W.p / W.rho;
+    template <std::size_t N>
+    [[nodiscard]] constexpr T enthalpy(const Primitive<N>& W) const noexcept {
+        const T e_int = internal_energy(W.rho, W.p);
+        return e_int + T{0.5} * W.u * W.u + W.p / W.rho;
     }
 
     /// Convert primitive to conservative variables
-    [[nodiscard]] constexpr ConservativeVars to_conservative(const PrimitiveVars& W) const noexcept {
-        return ConservativeVars{
+    template <std::size_t N>
+    [[nodiscard]] constexpr Conservative<N> to_conservative(const Primitive<N>& W) const noexcept {
+        Conservative<N> U{
             W.rho,
             W.rho * W.u,
             total_energy(W)
         };
+        U.for_each_scalar([&](auto k) { U.rho_phi[k] = W.rho * W.phi[k]; });
+        return U;
     }
 
     /// Convert conservative to primitive variables
-    [[nodiscard]] constexpr PrimitiveVars to_primitive(const ConservativeVars& U) const noexcept {
-        const Real rho = U.rho;
-        const Real u = U.rho_u / rho;
-        const Real p = pressure(U);
-        return PrimitiveVars{rho, u, p};
+    template <std::size_t N>
+    [[nodiscard]] constexpr Primitive<N> to_primitive(const Conservative<N>& U) const noexcept {
+        const T rho = U.rho;
+        const T u = U.rho_u / rho;
+        const T p = pressure(U);
+        Primitive<N> W{rho, u, p};
+        W.for_each_scalar([&](auto k) { W.phi[k] = U.rho_phi[k] / rho; });
+        return W;
     }
 
     /// Compute the physical flux F(U)
-    [[nodiscard]] constexpr ConservativeVars flux(const ConservativeVars& U) const noexcept {
-        const Real rho = U.rho;
-        const Real u = U.rho_u / rho;
-        const Real p = pressure(U);
-        return ConservativeVars{
+    template <std::size_t N>
+    [[nodiscard]] constexpr Conservative<N> flux(const Conservative<N>& U) const noexcept {
+        return flux(U, U.rho_u / U.rho, pressure(U));
+    }
+
+    /// Compute the physical flux F(U) from the velocity and pressure of U
+    template <std::size_t N>
+    [[nodiscard]] constexpr Conservative<N> flux(const Conservative<N>& U, T u, T p) const noexcept {
+        Conservative<N> F{
             U.rho_u,                    // ρu
             U.rho_u * u + p,            // ρu² + p
             (U.E + p) * u               // (E + p)u
         };
+        F.for_each_scalar([&](auto k) { F.rho_phi[k] = U.rho_phi[k] * u; });  // ρφu
+        return F;
+    }
+
+    /**
+     * @brief Jacobian dF/dU of the physical flux, row-major
+     *
+     * Rows of the passive scalars are rho*phi_k*u differentiated; the
+     * scalars do not enter the pressure, so their columns are zero in the
+     * Euler rows.
+     */
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::array<std::array<T, N>, N> flux_jacobian(const Conservative<N>& U) const noexcept {
+        const T u = U.rho_u / U.rho;
+        const T H = enthalpy(U);
+        const T gm1 = gamma - T{1};
+        std::array<std::array<T, N>, N> A{};
+        A[0][1] = T{1};
+        A[1][0] = T{0.5} * (gamma - T{3}) * u * u;
+        A[1][1] = (T{3} - gamma) * u;
+        A[1][2] = gm1;
+        A[2][0] = u * (T{0.5} * gm1 * u * u - H);
+        A[2][1] = H - gm1 * u * u;
+        A[2][2] = gamma * u;
+        U.for_each_scalar([&](auto k) {
+            const T phi = U.rho_phi[k] / U.rho;
+            A[3 + k][0] = -phi * u;
+            A[3 + k][1] = phi;
+            A[3 + k][3 + k] = u;
+        });
+        return A;
     }
 
     /// Compute the physical flux from primitive variables
-    [[nodiscard]] constexpr ConservativeVars flux(const PrimitiveVars& W) const noexcept {
-        const Real E = total_energy(W);
-        return ConservativeVars{
+    template <std::size_t N>
+    [[nodiscard]] constexpr Conservative<N> flux(const Primitive<N>& W) const noexcept {
+        const T E = total_energy(W);
+        Conservative<N> F{
             W.rho * W.u,                        // ρu
             W.rho * W.u * W.u + W.p,            // ρu² + p
             (E + W.p) * W.u                     // (E + p)u
         };
+        F.for_each_scalar([&](auto k) { F.rho_phi[k] = W.rho * W.u * W.phi[k]; });  // ρφu
+        return F;
     }
 };
 
+/// Ideal gas in the default precision
+using IdealGas = BasicIdealGas<Real>;
+
 // =============================================================================
 // EOS Variant type for runtime selection
 // =============================================================================
 
 /// Variant holding all supported equations of state
-using EosVariant = std::variant<IdealGas>;
+template <typename T>
+using BasicEosVariant = std::variant<BasicIdealGas<T>>;
+
+using EosVariant = BasicEosVariant<Real>;
 
 // =============================================================================
 // Free functions dispatched via std::visit
 // =============================================================================
 
 /// Compute pressure from conservative variables (any EOS)
-[[nodiscard]] inline Real pressure(const EosVariant& eos, const ConservativeVars& U) {
+template <typename T, std::size_t N>
+[[nodiscard]] inline T pressure(const BasicEosVariant<T>& eos, const BasicConservativeVars<T, N>& U) {
     return std::visit([&U](const auto& e) { return e.pressure(U); }, eos);
 }
 
 /// Compute sound speed (any EOS)
-[[nodiscard]] inline Real sound_speed(const EosVariant& eos, const ConservativeVars& U) {
+template <typename T, std::size_t N>
+[[nodiscard]] inline T sound_speed(const BasicEosVariant<T>& eos, const BasicConservativeVars<T, N>& U) {
     return std::visit([&U](const auto& e) { return e.sound_speed(U); }, eos);
 }
 
 /// Convert primitive to conservative (any EOS)
-[[nodiscard]] inline ConservativeVars to_conservative(const EosVariant& eos, const PrimitiveVars& W) {
+template <typename T, std::size_t N>
+[[nodiscard]] inline BasicConservativeVars<T, N> to_conservative(const BasicEosVariant<T>& eos,
+                                                                 const BasicPrimitiveVars<T, N>& W) {
     return std::visit([&W](const auto& e) { return e.to_conservative(W); }, eos);
 }
 
 /// Convert conservative to primitive (any EOS)
-[[nodiscard]] inline PrimitiveVars to_primitive(const EosVariant& eos, const ConservativeVars& U) {
+template <typename T, std::size_t N>
+[[nodiscard]] inline BasicPrimitiveVars<T, N> to_primitive(const BasicEosVariant<T>& eos,
+                                                           const BasicConservativeVars<T, N>& U) {
     return std::visit([&U](const auto& e) { return e.to_primitive(U); }, eos);
 }
 
 /// Compute physical flux (any EOS)
-[[nodiscard]] inline ConservativeVars flux(const EosVariant& eos, const ConservativeVars& U) {
+template <typename T, std::size_t N>
+[[nodiscard]] inline BasicConservativeVars<T, N> flux(const BasicEosVariant<T>& eos,
+                                                      const BasicConservativeVars<T, N>& U) {
     return std::visit([&U](const auto& e) { return e.flux(U); }, eos);
 }
 
@@ -0,0 +1,87 @@
+/**
+ * @file euler1d_c.h
+ * @brief C interface to the solver for C and Fortran hosts
+ *
+ * The solver is an opaque handle created from a TOML configuration file.
+ * Functions that can fail return EULER1D_OK or EULER1D_ERROR; the message of
+ * the last failure on the calling thread is available from
+ * euler1d_last_error(). No C++ exception crosses this interface.
+ *
+ * The state is exposed without copies as an array of num_cells interior
+ * cells, each stored as euler1d_num_components() values: (rho, rho*u, E)
+ * followed by the partial densities rho*phi_k of the passive scalars
+ * (none unless built with EULER1D_NUM_SCALARS). Its element type is the
+ * storage precision selected by [execution] precision: use euler1d_state_f64
+ * for "double" and euler1d_state_f32 for "float" and "mixed"; the other
+ * accessor returns NULL.
+ *
+ * With [mesh] expand, num_cells is the size of the window being stepped, and
+ * euler1d_step, euler1d_advance_to and euler1d_run may grow it: they
+ * invalidate the state pointers and may change euler1d_num_cells and the
+ * cell centres, so hosts query all three again after each of these calls.
+ */
+
+#ifndef EULER1D_EULER1D_C_H
+#define EULER1D_EULER1D_C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status codes */
+#define EULER1D_OK 0
+#define EULER1D_ERROR 1
+
+/** Opaque solver handle */
+typedef struct euler1d_solver euler1d_solver;
+
+/** Create a solver from a configuration file; returns NULL on failure */
+euler1d_solver* euler1d_create(const char* config_path);
+
+/** Destroy a solver created by euler1d_create (NULL is ignored) */
+void euler1d_destroy(euler1d_solver* solver);
+
+/** Message of the last failed call on this thread ("" if none) */
+const char* euler1d_last_error(void);
+
+/** Advance by one step of size dt */
+int euler1d_step(euler1d_solver* solver, double dt);
+
+/** Advance with CFL-limited steps until time t */
+int euler1d_advance_to(euler1d_solver* solver, double t);
+
+/** Run to the configured final time */
+int euler1d_run(euler1d_solver* solver);
+
+/** Stable timestep for the current state, stored in *dt */
+int euler1d_compute_dt(const euler1d_solver* solver, double* dt);
+
+/** Current simulation time */
+double euler1d_time(const euler1d_solver* solver);
+
+/** Number of steps taken so far */
+int euler1d_steps(const euler1d_solver* solver);
+
+/** Number of interior cells (with [mesh] expand, of the current window) */
+int euler1d_num_cells(const euler1d_solver* solver);
+
+/** Values per cell in the state arrays (3 + number of passive scalars) */
+int euler1d_num_components(void);
+
+/** Cell-centre coordinates of the interior cells, written to x[0..num_cells) */
+void euler1d_cell_centers(const euler1d_solver* solver, double* x);
+
+/** Interior state in double precision, or NULL if stored in float; with [mesh] expand, valid until the next step */
+double* euler1d_state_f64(euler1d_solver* solver);
+
+/** Interior state in single precision, or NULL if stored in double; with [mesh] expand, valid until the next step */
+float* euler1d_state_f32(euler1d_solver* solver);
+
+/** Print progress and run summaries to stdout (off by default) */
+void euler1d_set_verbose(euler1d_solver* solver, int verbose);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EULER1D_EULER1D_C_H */
@@ -3,20 +3,99 @@
  * @brief Numerical flux schemes for the 1D Euler equations
  *
  * All flux schemes compute the numerical flux at a cell interface
- * given left and right states.
+ * given left and right states. Schemes are stateless and evaluate in the
+ * precision and component count of the states passed in; passive scalars
+ * are upwinded with the mass flux.
+ *
+ * Every scheme also takes precomputed cell states (BasicCellState), which
+ * carry the pressure, sound speed and physical flux of a cell so the two
+ * interfaces of the cell share them. The overloads on conservative states
+ * evaluate these on the spot.
  */
 
 #ifndef EULER1D_FLUX_FLUX_HPP
 #define EULER1D_FLUX_FLUX_HPP
 
 #include "../core/types.hpp"
+#include "../core/constants.hpp"
 #include "../eos/eos.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <span>
 #include <variant>
 
 namespace euler1d {
 
+// =============================================================================
+// Precomputed cell states
+// =============================================================================
+
+/// Quantities of one cell that the flux schemes use on both of its faces
+template <typename T, std::size_t N = num_components>
+struct BasicCellState {
+    BasicConservativeVars<T, N> U;  ///< Conservative state
+    BasicConservativeVars<T, N> F;  ///< Physical flux F(U)
+    T u;                            ///< Velocity
+    T p;                            ///< Pressure
+    T c;                            ///< Sound speed
+    T inv_rho;                      ///< 1 / rho
+};
+
+/// Evaluate the cell state of U
+template <typename T, std::size_t N, typename Eos>
+[[nodiscard]] inline BasicCellState<T, N> make_cell_state(const BasicConservativeVars<T, N>& U,
+                                                          const Eos& eos) noexcept {
+    const T inv_rho = T{1} / U.rho;
+    const T u = U.rho_u * inv_rho;
+    const T p = eos.pressure(U);
+    return {U, eos.flux(U, u, p), u, p, eos.sound_speed(U.rho, p), inv_rho};
+}
+
+/**
+ * @brief Cell states of a buffer of cells as a structure of arrays
+ *
+ * fill() is a branch-free pass over the cells, so its divisions and square
+ * roots vectorize, while the branching flux loop only reads the results.
+ * The conservative state itself stays in the solution array.
+ */
+template <typename T, std::size_t N = num_components>
+struct BasicCellCache {
+    ArenaVector<T> u;
+    ArenaVector<T> p;
+    ArenaVector<T> c;
+    ArenaVector<T> inv_rho;
+    ArenaVector<BasicConservativeVars<T, N>> F;
+
+    void resize(std::size_t n) {
+        u.resize(n);
+        p.resize(n);
+        c.resize(n);
+        inv_rho.resize(n);
+        F.resize(n);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return u.size(); }
+
+    /// Evaluate the states of all cells of U (any storage precision) in T
+    template <typename S, typename Eos>
+    void fill(std::span<const BasicConservativeVars<S, N>> U, const Eos& eos) noexcept {
+        for (std::size_t i = 0; i < U.size(); ++i) {
+            const auto state = make_cell_state(precision_cast<T>(U[i]), eos);
+            u[i] = state.u;
+            p[i] = state.p;
+            c[i] = state.c;
+            inv_rho[i] = state.inv_rho;
+            F[i] = state.F;
+        }
+    }
+
+    /// State of cell i, given its conservative values in T
+    [[nodiscard]] BasicCellState<T, N> operator()(std::size_t i, const BasicConservativeVars<T, N>& U_i) const noexcept {
+        return {U_i, F[i], u[i], p[i], c[i], inv_rho[i]};
+    }
+};
+
 // =============================================================================
 // Local Lax-Friedrichs (LLF) Flux
 // =============================================================================
@@ -28,27 +107,25 @@ namespace euler1d {
  * where λ_max = max(|u_L| + c_L, |u_R| + c_R)
  */
 struct LLFFlux {
-    template <typename Eos>
-    [[nodiscard]] ConservativeVars operator()(
-        const ConservativeVars& U_L,
-        const ConservativeVars& U_R,
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
         const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
 
-        // Compute physical fluxes
-        const auto F_L = eos.flux(U_L);
-        const auto F_R = eos.flux(U_R);
-
-        // Compute wave speeds
-        const Real u_L = U_L.rho_u / U_L.rho;
-        const Real u_R = U_R.rho_u / U_R.rho;
-        const Real c_L = eos.sound_speed(U_L);
-        const Real c_R = eos.sound_speed(U_R);
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& /*eos*/) const noexcept {
 
         // Maximum wave speed
-        const Real lambda_max = std::max(std::abs(u_L) + c_L, std::abs(u_R) + c_R);
+        const T lambda_max = std::max(std::abs(L.u) + L.c, std::abs(R.u) + R.c);
 
         // LLF flux
-        return Real{0.5} * (F_L + F_R) - Real{0.5} * lambda_max * (U_R - U_L);
+        return T{0.5} * (L.F + R.F) - T{0.5} * lambda_max * (R.U - L.U);
     }
 };
 
@@ -60,13 +137,21 @@ struct LLFFlux {
  * @brief Rusanov flux (alias for LLF)
  */
 struct RusanovFlux {
-    template <typename Eos>
-    [[nodiscard]] ConservativeVars operator()(
-        const ConservativeVars& U_L,
-        const ConservativeVars& U_R,
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
         const Eos& eos) const noexcept {
         return LLFFlux{}(U_L, U_R, eos);
     }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return LLFFlux{}(L, R, eos);
+    }
 };
 
 // =============================================================================
@@ -77,43 +162,31 @@ struct RusanovFlux {
  * @brief HLL flux with Davis wave speed estimates
  *
  * Two-wave approximate Riemann solver using fastest left and right
- * wave speeds.
+ * wave speeds. The speeds are clamped to S_L <= 0 <= S_R, which turns the
+ * three cases of HLL into one straight-line formula: a supersonic face
+ * gets S_L = 0 (or S_R = 0) and so the upwind physical flux. In this form
+ * it is the central-upwind flux of Kurganov, Noelle and Petrova.
  */
 struct HLLFlux {
-    template <typename Eos>
-    [[nodiscard]] ConservativeVars operator()(
-        const ConservativeVars& U_L,
-        const ConservativeVars& U_R,
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
         const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
 
-        // Left state
-        const Real rho_L = U_L.rho;
-        const Real u_L = U_L.rho_u / rho_L;
-        const Real p_L = eos.pressure(U_L);
-        const Real c_L = eos.sound_speed(rho_L, p_L);
-
-        // Right state
-        const Real rho_R = U_R.rho;
-        const Real u_R = U_R.rho_u / rho_R;
-        const Real p_R = eos.pressure(U_R);
-        const Real c_R = eos.sound_speed(rho_R, p_R);
-
-        // Davis wave speed estimates
-        const Real S_L = std::min(u_L - c_L, u_R - c_R);
-        const Real S_R = std::max(u_L + c_L, u_R + c_R);
-
-        // Physical fluxes
-        const auto F_L = eos.flux(U_L);
-        const auto F_R = eos.flux(U_R);
-
-        // HLL flux
-        if (S_L >= Real{0}) {
-            return F_L;
-        } else if (S_R <= Real{0}) {
-            return F_R;
-        } else {
-            return (S_R * F_L - S_L * F_R + S_L * S_R * (U_R - U_L)) / (S_R - S_L);
-        }
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& /*eos*/) const noexcept {
+
+        // Davis wave speed estimates, clamped; S_R - S_L >= 2c never vanishes
+        const T S_L = std::min({L.u - L.c, R.u - R.c, T{0}});
+        const T S_R = std::max({L.u + L.c, R.u + R.c, T{0}});
+        const T inv_width = T{1} / (S_R - S_L);
+        return (S_R * L.F - S_L * R.F + S_L * S_R * (R.U - L.U)) * inv_width;
     }
 };
 
@@ -128,64 +201,297 @@ struct HLLFlux {
  * better resolution of contact waves and shear layers.
  */
 struct HLLCFlux {
-    template <typename Eos>
-    [[nodiscard]] ConservativeVars operator()(
-        const ConservativeVars& U_L,
-        const ConservativeVars& U_R,
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
         const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
 
-        // Left state
-        const Real rho_L = U_L.rho;
-        const Real u_L = U_L.rho_u / rho_L;
-        const Real p_L = eos.pressure(U_L);
-        const Real c_L = eos.sound_speed(rho_L, p_L);
-        const Real E_L = U_L.E;
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& /*eos*/) const noexcept {
 
-        // Right state
-        const Real rho_R = U_R.rho;
-        const Real u_R = U_R.rho_u / rho_R;
-        const Real p_R = eos.pressure(U_R);
-        const Real c_R = eos.sound_speed(rho_R, p_R);
-        const Real E_R = U_R.E;
+        const T rho_L = L.U.rho;
+        const T u_L = L.u;
+        const T p_L = L.p;
+        const T rho_R = R.U.rho;
+        const T u_R = R.u;
+        const T p_R = R.p;
 
         // Wave speed estimates (Davis estimates)
-        const Real S_L = std::min(u_L - c_L, u_R - c_R);
-        const Real S_R = std::max(u_L + c_L, u_R + c_R);
+        const T S_L = std::min(u_L - L.c, u_R - R.c);
+        const T S_R = std::max(u_L + L.c, u_R + R.c);
 
         // Contact wave speed
-        const Real S_star = (p_R - p_L + rho_L * u_L * (S_L - u_L) - rho_R * u_R * (S_R - u_R)) /
+        const T S_star = (p_R - p_L + rho_L * u_L * (S_L - u_L) - rho_R * u_R * (S_R - u_R)) /
                             (rho_L * (S_L - u_L) - rho_R * (S_R - u_R));
 
-        // Physical fluxes
-        const auto F_L = eos.flux(U_L);
-        const auto F_R = eos.flux(U_R);
-
-        if (S_L >= Real{0}) {
-            return F_L;
-        } else if (S_R <= Real{0}) {
-            return F_R;
-        } else if (S_star >= Real{0}) {
-            // Left star state
-            const Real coeff = rho_L * (S_L - u_L) / (S_L - S_star);
-            const ConservativeVars U_star_L{
+        // Star state of side K with wave speed S_K: U*_K = coeff * (1, S*, E/rho + ..., phi)
+        auto star_flux = [S_star](const BasicCellState<T, N>& K, T S_K) {
+            const T coeff = K.U.rho * (S_K - K.u) / (S_K - S_star);
+            BasicConservativeVars<T, N> U_star{
                 coeff,
                 coeff * S_star,
-                coeff * (E_L / rho_L + (S_star - u_L) * (S_star + p_L / (rho_L * (S_L - u_L))))
+                coeff * (K.U.E * K.inv_rho + (S_star - K.u) * (S_star + K.p / (K.U.rho * (S_K - K.u))))
             };
-            return F_L + S_L * (U_star_L - U_L);
+            U_star.for_each_scalar([&](auto k) { U_star.rho_phi[k] = coeff * K.U.rho_phi[k] * K.inv_rho; });
+            return K.F + S_K * (U_star - K.U);
+        };
+
+        if (S_L >= T{0}) {
+            return L.F;
+        } else if (S_R <= T{0}) {
+            return R.F;
+        } else if (S_star >= T{0}) {
+            return star_flux(L, S_L);
         } else {
-            // Right star state
-            const Real coeff = rho_R * (S_R - u_R) / (S_R - S_star);
-            const ConservativeVars U_star_R{
-                coeff,
-                coeff * S_star,
-                coeff * (E_R / rho_R + (S_star - u_R) * (S_star + p_R / (rho_R * (S_R - u_R))))
-            };
-            return F_R + S_R * (U_star_R - U_R);
+            return star_flux(R, S_R);
         }
     }
 };
 
+// =============================================================================
+// Roe averages
+// =============================================================================
+
+/// Roe-averaged velocity, enthalpy and sound speed of a face
+template <typename T>
+struct BasicRoeAverage {
+    T u;  ///< Velocity
+    T H;  ///< Specific total enthalpy
+    T c;  ///< Sound speed
+};
+
+/// Roe average of the states next to a face, from sqrt(rho) of both sides (ideal gas)
+template <typename T, typename Eos>
+[[nodiscard]] inline BasicRoeAverage<T> make_roe_average(T sqrt_rho_L, T u_L, T H_L, T sqrt_rho_R, T u_R, T H_R,
+                                                        const Eos& eos) noexcept {
+    const T inv_sum = T{1} / (sqrt_rho_L + sqrt_rho_R);
+    const T u = (sqrt_rho_L * u_L + sqrt_rho_R * u_R) * inv_sum;
+    const T H = (sqrt_rho_L * H_L + sqrt_rho_R * H_R) * inv_sum;
+    const T c_sq = (static_cast<T>(eos.gamma) - T{1}) * (H - T{0.5} * u * u);
+    return {u, H, std::sqrt(std::max(c_sq, constants::min_pressure_v<T>))};
+}
+
+/// Roe average of two cell states
+template <typename T, std::size_t N, typename Eos>
+[[nodiscard]] inline BasicRoeAverage<T> make_roe_average(const BasicCellState<T, N>& L, const BasicCellState<T, N>& R,
+                                                        const Eos& eos) noexcept {
+    return make_roe_average(std::sqrt(L.U.rho), L.u, (L.U.E + L.p) * L.inv_rho,
+                            std::sqrt(R.U.rho), R.u, (R.U.E + R.p) * R.inv_rho, eos);
+}
+
+/**
+ * @brief Schemes that take the Roe average of a face as an extra argument
+ *
+ * At first order the solver computes the averages of all faces in batched
+ * passes (BasicRoeAverageCache), so their square roots vectorize.
+ */
+template <typename Flux>
+concept RoeAveragedFlux = requires { requires Flux::roe_averaged; };
+
+/**
+ * @brief Roe averages of the faces of a buffer of cells, as a structure of arrays
+ *
+ * fill() takes sqrt(rho) and H of every cell in one pass and averages every
+ * face in a second one. Neither branches, so both vectorize. Face i lies
+ * between cells i and i + 1.
+ */
+template <typename T>
+struct BasicRoeAverageCache {
+    ArenaVector<T> sqrt_rho;  ///< Per cell
+    ArenaVector<T> H;         ///< Per cell, then per face
+    ArenaVector<T> u;         ///< Per face
+    ArenaVector<T> c;         ///< Per face
+
+    void resize(std::size_t n) {
+        sqrt_rho.resize(n);
+        H.resize(n);
+        u.resize(n);
+        c.resize(n);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return sqrt_rho.size(); }
+
+    /// Average all faces of U (any storage precision), given the filled cell states of U
+    template <typename S, std::size_t N, typename Eos>
+    void fill(std::span<const BasicConservativeVars<S, N>> U, const BasicCellCache<T, N>& cells,
+              const Eos& eos) noexcept {
+        for (std::size_t i = 0; i < U.size(); ++i) {
+            sqrt_rho[i] = std::sqrt(static_cast<T>(U[i].rho));
+            H[i] = (static_cast<T>(U[i].E) + cells.p[i]) * cells.inv_rho[i];
+        }
+        // In place: face i reads cell i + 1 before a later face overwrites it
+        for (std::size_t i = 0; i + 1 < U.size(); ++i) {
+            const auto avg = make_roe_average(sqrt_rho[i], cells.u[i], H[i], sqrt_rho[i + 1], cells.u[i + 1],
+                                              H[i + 1], eos);
+            u[i] = avg.u;
+            H[i] = avg.H;
+            c[i] = avg.c;
+        }
+    }
+
+    /// Average of face i
+    [[nodiscard]] BasicRoeAverage<T> operator()(std::size_t i) const noexcept { return {u[i], H[i], c[i]}; }
+};
+
+// =============================================================================
+// Roe Flux
+// =============================================================================
+
+/**
+ * @brief Roe flux with the Harten-Hyman entropy fix (ideal gas)
+ *
+ * F = (F_L + F_R) / 2 - 1/2 * sum_k |lambda_k| alpha_k K_k over the waves
+ * u - c, u, u + c of the Roe average. In a transonic rarefaction the
+ * acoustic speeds are kept away from zero: |lambda_k| >= delta_k with
+ *   delta_k = max(0, lambda_k - lambda_k(U_L), lambda_k(U_R) - lambda_k),
+ * which prevents expansion shocks at sonic points.
+ */
+struct RoeFlux {
+    static constexpr bool roe_averaged = true;
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return (*this)(L, R, make_roe_average(L, R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const BasicRoeAverage<T>& avg,
+        const Eos& eos) const noexcept {
+        const T gm1 = static_cast<T>(eos.gamma) - T{1};
+        const T u = avg.u;
+        const T c = avg.c;
+        const T inv_c = T{1} / c;
+
+        // Wave strengths of the jump (Toro 11.3)
+        const T d_rho = R.U.rho - L.U.rho;
+        const T d_mom = R.U.rho_u - L.U.rho_u;
+        const T d_E = R.U.E - L.U.E;
+        const T alpha_2 = gm1 * inv_c * inv_c * (d_rho * (avg.H - u * u) + u * d_mom - d_E);
+        const T alpha_1 = T{0.5} * inv_c * (d_rho * (u + c) - d_mom - c * alpha_2);
+        const T alpha_3 = d_rho - alpha_1 - alpha_2;
+
+        // Harten-Hyman entropy fix on the acoustic waves
+        auto fixed = [](T lambda, T lambda_L, T lambda_R) {
+            const T delta = std::max({T{0}, lambda - lambda_L, lambda_R - lambda});
+            return std::max(std::abs(lambda), delta);
+        };
+        const T a_1 = alpha_1 * fixed(u - c, L.u - L.c, R.u - R.c);
+        const T a_2 = alpha_2 * std::abs(u);
+        const T a_3 = alpha_3 * fixed(u + c, L.u + L.c, R.u + R.c);
+
+        BasicConservativeVars<T, N> F{
+            T{0.5} * (L.F.rho + R.F.rho - (a_1 + a_2 + a_3)),
+            T{0.5} * (L.F.rho_u + R.F.rho_u - (a_1 * (u - c) + a_2 * u + a_3 * (u + c))),
+            T{0.5} * (L.F.E + R.F.E - (a_1 * (avg.H - u * c) + a_2 * T{0.5} * u * u + a_3 * (avg.H + u * c)))
+        };
+        // Scalars are carried with the mass flux, upwind by its sign
+        F.for_each_scalar([&](auto k) {
+            const auto& K = F.rho > T{0} ? L : R;
+            F.rho_phi[k] = F.rho * K.U.rho_phi[k] * K.inv_rho;
+        });
+        return F;
+    }
+};
+
+// =============================================================================
+// HLLE Flux (HLL with Einfeldt wave speeds)
+// =============================================================================
+
+/**
+ * @brief HLLE flux: the HLL flux with Einfeldt's wave speed estimates
+ *
+ * S_L = min(u_L - c_L, u - c) and S_R = max(u_R + c_R, u + c) with the Roe
+ * average, which bound the physical speeds more tightly than the Davis
+ * estimates of HLLFlux and keep the scheme positive.
+ */
+struct HLLEFlux {
+    static constexpr bool roe_averaged = true;
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return (*this)(L, R, make_roe_average(L, R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const BasicRoeAverage<T>& avg,
+        const Eos& /*eos*/) const noexcept {
+        const T S_L = std::min(L.u - L.c, avg.u - avg.c);
+        const T S_R = std::max(R.u + R.c, avg.u + avg.c);
+
+        if (S_L >= T{0}) {
+            return L.F;
+        } else if (S_R <= T{0}) {
+            return R.F;
+        } else {
+            return (S_R * L.F - S_L * R.F + S_L * S_R * (R.U - L.U)) / (S_R - S_L);
+        }
+    }
+};
+
+// =============================================================================
+// Kurganov-Tadmor central-upwind flux
+// =============================================================================
+
+/**
+ * @brief Central-upwind flux of Kurganov, Noelle and Petrova (same as HLL)
+ *
+ * With the one-sided speeds a+ = max(u + c, 0) and a- = min(u - c, 0) over
+ * both cells, the central-upwind flux is exactly HLL with Davis speeds in
+ * its branch-free form, so it forwards to HLLFlux. The name is kept for
+ * configurations that ask for it.
+ */
+struct KurganovTadmorFlux {
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return HLLFlux{}(U_L, U_R, eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return HLLFlux{}(L, R, eos);
+    }
+};
+
 // =============================================================================
 // MOVERS Flux (Exact shock and contact wave speed estimates)
 // =============================================================================
@@ -196,52 +502,60 @@ struct HLLCFlux {
  * Steady contacts and shocks are captured exactly 
  */
 struct MoversLEFlux {
-    template <typename Eos>
-    [[nodiscard]] ConservativeVars operator()(
-        const ConservativeVars& U_L,
-        const ConservativeVars& U_R,
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
         const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
 
-        // Compute physical fluxes
-        const auto F_L = eos.flux(U_L);
-        const auto F_R = eos.flux(U_R);
-
-        // Compute wave speeds
-        const Real u_L = U_L.rho_u / U_L.rho;
-        const Real u_R = U_R.rho_u / U_R.rho;
-        const Real c_L = eos.sound_speed(U_L);
-        const Real c_R = eos.sound_speed(U_R);
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& /*eos*/) const noexcept {
+        const auto& F_L = L.F;
+        const auto& F_R = R.F;
+        const auto& U_L = L.U;
+        const auto& U_R = R.U;
 
         // Maximum Minimum wave speed
-        const auto lambda_max_min = max_min_eig_value(u_L, u_R, c_L, c_R);
+        const auto lambda_max_min = max_min_eig_value(L.u, R.u, L.c, R.c);
 
         // MoversLE flux (component-wise dissipation)
-        auto flux_component = [this, &lambda_max_min](Real flux_R, Real flux_L, Real U_R_var, Real U_L_var) {
-            const Real diss = compute_dissipation(flux_R, flux_L, U_R_var, U_L_var, lambda_max_min.first, lambda_max_min.second);
-            return Real{0.5} * (flux_L + flux_R) - Real{0.5} * diss * (U_R_var - U_L_var);
+        auto flux_component = [this, &lambda_max_min](T flux_R, T flux_L, T U_R_var, T U_L_var) {
+            const T diss = compute_dissipation(flux_R, flux_L, U_R_var, U_L_var, lambda_max_min.first, lambda_max_min.second);
+            return T{0.5} * (flux_L + flux_R) - T{0.5} * diss * (U_R_var - U_L_var);
         };
 
-        return {
+        BasicConservativeVars<T, N> F{
             flux_component(F_R.rho, F_L.rho, U_R.rho, U_L.rho),
             flux_component(F_R.rho_u, F_L.rho_u, U_R.rho_u, U_L.rho_u),
             flux_component(F_R.E, F_L.E, U_R.E, U_L.E)
         };
+        F.for_each_scalar([&](auto k) {
+            F.rho_phi[k] = flux_component(F_R.rho_phi[k], F_L.rho_phi[k], U_R.rho_phi[k], U_L.rho_phi[k]);
+        });
+        return F;
     }
 
-    auto max_min_eig_value(Real ul, Real ur, Real cl, Real cr) const noexcept {
-        const Real L1r = std::abs(ur + cr), L1l = std::abs(ul + cl);
-        const Real L2r = std::abs(ur),     L2l = std::abs(ul);
-        const Real L3r = std::abs(ur - cr), L3l = std::abs(ul - cl);
+    template <typename T>
+    auto max_min_eig_value(T ul, T ur, T cl, T cr) const noexcept {
+        const T L1r = std::abs(ur + cr), L1l = std::abs(ul + cl);
+        const T L2r = std::abs(ur),     L2l = std::abs(ul);
+        const T L3r = std::abs(ur - cr), L3l = std::abs(ul - cl);
         
         auto max_eig_va = std::max({std::max({L1r, L2r, L3r}), std::max({L1l, L2l, L3l})});    
         auto min_eig_val =  std::min({std::min({L1r, L2r, L3r}), std::min({L1l, L2l, L3l})});
-        return std::pair<Real, Real>{max_eig_va, min_eig_val};
+        return std::pair<T, T>{max_eig_va, min_eig_val};
     }
 
-    auto compute_dissipation(Real Fr, Real Fl, Real Ur, Real Ul, Real L_max, Real L_min) const noexcept {
-        const Real epsilon = Real{1e-6};
-        Real S{0.0};
-        if (std::abs(Fr - Fl) < epsilon) return Real{0};
+    template <typename T>
+    auto compute_dissipation(T Fr, T Fl, T Ur, T Ul, T L_max, T L_min) const noexcept {
+        const T epsilon = static_cast<T>(1e-6);
+        T S{0.0};
+        if (std::abs(Fr - Fl) < epsilon) return T{0};
         if (std::abs(Ur - Ul) < epsilon) return L_min;
         
         if (std::abs(Ur - Ul) > epsilon && std::abs(Fr - Fl) > epsilon) {
@@ -250,30 +564,369 @@ struct MoversLEFlux {
             S = L_min;
         }
         
-        if (S < epsilon) return Real{0};
+        if (S < epsilon) return T{0};
         if (S >= L_max) return L_max;
         if (S <= L_min) return L_min;
         return S;
     }
 };
 
+// =============================================================================
+// Flux vector splitting
+// =============================================================================
+
+/**
+ * @brief Flux vector splitting schemes: F_{i+1/2} = F+(U_L) + F-(U_R)
+ *
+ * plus() and minus() depend on one cell only, so at first order the solver
+ * evaluates them once per cell (BasicSplitFluxCache) and a face costs one
+ * addition.
+ */
+template <typename Flux>
+concept VectorSplitFlux = requires { requires Flux::vector_splitting; };
+
+/**
+ * @brief Split fluxes of a buffer of cells
+ *
+ * fill() evaluates F+ and F- of every cell in one pass without branches
+ * (the splittings select with conditional expressions), so it vectorizes.
+ */
+template <typename T, std::size_t N = num_components>
+struct BasicSplitFluxCache {
+    ArenaVector<BasicConservativeVars<T, N>> F_plus;
+    ArenaVector<BasicConservativeVars<T, N>> F_minus;
+
+    void resize(std::size_t n) {
+        F_plus.resize(n);
+        F_minus.resize(n);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return F_plus.size(); }
+
+    /// Split the fluxes of all cells of U (any storage precision) in T
+    template <typename S, typename Eos, VectorSplitFlux Flux>
+    void fill(std::span<const BasicConservativeVars<S, N>> U, const Eos& eos, const Flux& flux) noexcept {
+        for (std::size_t i = 0; i < U.size(); ++i) {
+            const auto state = make_cell_state(precision_cast<T>(U[i]), eos);
+            F_plus[i] = flux.plus(state, eos);
+            F_minus[i] = flux.minus(state, eos);
+        }
+    }
+
+    /// Flux at the face between cells i and i + 1
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(std::size_t i) const noexcept {
+        return F_plus[i] + F_minus[i + 1];
+    }
+};
+
+/**
+ * @brief Steger-Warming flux vector splitting (ideal gas)
+ *
+ * Splits the eigenvalues u - c, u, u + c into their positive and negative
+ * parts: F± = rho / (2 gamma) * [l1 + 2 (gamma-1) l2 + l3,
+ * (u-c) l1 + 2 (gamma-1) u l2 + (u+c) l3, (H-uc) l1 + (gamma-1) u^2 l2 + (H+uc) l3]
+ * with l = lambda±. Very robust, but the splitting is not smooth at sonic
+ * points and diffuses contacts.
+ */
+struct StegerWarmingFlux {
+    static constexpr bool vector_splitting = true;
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return plus(L, eos) + minus(R, eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> plus(const BasicCellState<T, N>& K, const Eos& eos) const noexcept {
+        return split(K, eos, T{1});
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> minus(const BasicCellState<T, N>& K, const Eos& eos) const noexcept {
+        return split(K, eos, T{-1});
+    }
+
+private:
+    /// F+ for sign = 1, F- for sign = -1
+    template <typename T, std::size_t N, typename Eos>
+    static BasicConservativeVars<T, N> split(const BasicCellState<T, N>& K, const Eos& eos, T sign) noexcept {
+        const T gamma = static_cast<T>(eos.gamma);
+        const T gm1 = gamma - T{1};
+        const T u = K.u;
+        const T c = K.c;
+        const T H = (K.U.E + K.p) * K.inv_rho;
+        const T l1 = T{0.5} * ((u - c) + sign * std::abs(u - c));
+        const T l2 = T{0.5} * (u + sign * std::abs(u));
+        const T l3 = T{0.5} * ((u + c) + sign * std::abs(u + c));
+        const T scale = K.U.rho / (T{2} * gamma);
+        BasicConservativeVars<T, N> F{
+            scale * (l1 + T{2} * gm1 * l2 + l3),
+            scale * ((u - c) * l1 + T{2} * gm1 * u * l2 + (u + c) * l3),
+            scale * ((H - u * c) * l1 + gm1 * u * u * l2 + (H + u * c) * l3)
+        };
+        F.for_each_scalar([&](auto k) { F.rho_phi[k] = F.rho * K.U.rho_phi[k] * K.inv_rho; });
+        return F;
+    }
+};
+
+/**
+ * @brief Van Leer flux vector splitting (ideal gas)
+ *
+ * With M = u / c, subsonic cells split as
+ *   F± = ±rho c (M ± 1)^2 / 4 * [1, ((gamma-1) u ± 2c) / gamma,
+ *                                ((gamma-1) u ± 2c)^2 / (2 (gamma^2 - 1))],
+ * and supersonic cells put all of F on the upwind side. The splitting is
+ * continuously differentiable at sonic points, unlike Steger-Warming.
+ */
+struct VanLeerFlux {
+    static constexpr bool vector_splitting = true;
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        return plus(L, eos) + minus(R, eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> plus(const BasicCellState<T, N>& K, const Eos& eos) const noexcept {
+        return split(K, eos, T{1});
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> minus(const BasicCellState<T, N>& K, const Eos& eos) const noexcept {
+        return split(K, eos, T{-1});
+    }
+
+private:
+    /// F+ for sign = 1, F- for sign = -1
+    template <typename T, std::size_t N, typename Eos>
+    static BasicConservativeVars<T, N> split(const BasicCellState<T, N>& K, const Eos& eos, T sign) noexcept {
+        const T gamma = static_cast<T>(eos.gamma);
+        const T gm1 = gamma - T{1};
+        const T M = K.u / K.c;
+        const T f_mass = sign * T{0.25} * K.U.rho * K.c * (M + sign) * (M + sign);
+        const T w = gm1 * K.u + sign * T{2} * K.c;
+        BasicConservativeVars<T, N> F_sub{
+            f_mass,
+            f_mass * w / gamma,
+            f_mass * w * w / (T{2} * (gamma * gamma - T{1}))
+        };
+        F_sub.for_each_scalar([&](auto k) { F_sub.rho_phi[k] = f_mass * K.U.rho_phi[k] * K.inv_rho; });
+
+        // Supersonic: all of F upwind, nothing downwind
+        const bool upwind = sign * M >= T{1};
+        const bool downwind = sign * M <= T{-1};
+        BasicConservativeVars<T, N> F;
+        for (std::size_t k = 0; k < F.size(); ++k) {
+            F[k] = upwind ? K.F[k] : (downwind ? T{0} : F_sub[k]);
+        }
+        return F;
+    }
+};
+
+/**
+ * @brief AUSM+ and AUSM+-up fluxes (Liou, JCP 129 (1996) and 214 (2006))
+ *
+ * The face flux is a mass flux, upwinded with the convected quantities
+ * (1, u, H, phi), plus a pressure flux:
+ *   F = mdot * psi_{L or R} + (0, p_{1/2}, 0),
+ *   mdot = c_{1/2} M_{1/2} rho_{L or R},
+ *   M_{1/2} = M4+(M_L) + M4-(M_R),  p_{1/2} = P5+(M_L) p_L + P5-(M_R) p_R,
+ * with the common sound speed c_{1/2} of the face, so the scheme does not
+ * split per cell. The per-cell inputs (u, p, c, H) come from the cell
+ * states. With Up, the pressure diffusion term of M_{1/2} and the velocity
+ * diffusion term of p_{1/2} (K_p = 1/4, K_u = 3/4, sigma = 1, no low-Mach
+ * scaling) are added, which damps the odd-even decoupling of AUSM+ at slow
+ * flow.
+ */
+template <bool Up>
+struct BasicAUSMPlusFlux {
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicConservativeVars<T, N>& U_L,
+        const BasicConservativeVars<T, N>& U_R,
+        const Eos& eos) const noexcept {
+        return (*this)(make_cell_state(U_L, eos), make_cell_state(U_R, eos), eos);
+    }
+
+    template <typename T, std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> operator()(
+        const BasicCellState<T, N>& L,
+        const BasicCellState<T, N>& R,
+        const Eos& eos) const noexcept {
+        constexpr T beta = T{1} / T{8};
+        constexpr T alpha = T{3} / T{16};
+        constexpr T K_p = T{0.25};
+        constexpr T K_u = T{0.75};
+        constexpr T sigma = T{1};
+
+        const T gamma = static_cast<T>(eos.gamma);
+        const T H_L = (L.U.E + L.p) * L.inv_rho;
+        const T H_R = (R.U.E + R.p) * R.inv_rho;
+
+        // Common sound speed from the critical speeds of both sides
+        const T c_star_factor = T{2} * (gamma - T{1}) / (gamma + T{1});
+        const T c_star_sq_L = c_star_factor * H_L;
+        const T c_star_sq_R = c_star_factor * H_R;
+        const T c_half = std::min(c_star_sq_L / std::max(std::sqrt(c_star_sq_L), L.u),
+                                  c_star_sq_R / std::max(std::sqrt(c_star_sq_R), -R.u));
+        const T inv_c_half = T{1} / c_half;
+        const T M_L = L.u * inv_c_half;
+        const T M_R = R.u * inv_c_half;
+
+        // Split Mach number polynomials: degree 4 for M, degree 5 for p
+        auto M2 = [](T M, T s) { return s * T{0.25} * (M + s) * (M + s); };
+        auto M4 = [&](T M, T s) {
+            return std::abs(M) >= T{1} ? T{0.5} * (M + s * std::abs(M))
+                                       : M2(M, s) * (T{1} - s * T{16} * beta * M2(M, -s));
+        };
+        auto P5 = [&](T M, T s) {
+            return std::abs(M) >= T{1} ? T{0.5} * (T{1} + s * (M > T{0} ? T{1} : T{-1}))
+                                       : M2(M, s) * ((s * T{2} - M) - s * T{16} * alpha * M * M2(M, -s));
+        };
+
+        T M_half = M4(M_L, T{1}) + M4(M_R, T{-1});
+        const T P_L = P5(M_L, T{1});
+        const T P_R = P5(M_R, T{-1});
+        T p_half = P_L * L.p + P_R * R.p;
+        if constexpr (Up) {
+            const T rho_sum = L.U.rho + R.U.rho;
+            const T M_bar_sq = T{0.5} * (M_L * M_L + M_R * M_R);
+            M_half -= K_p * std::max(T{1} - sigma * M_bar_sq, T{0}) * (R.p - L.p) * T{2} * inv_c_half *
+                      inv_c_half / rho_sum;
+            p_half -= K_u * P_L * P_R * rho_sum * c_half * (R.u - L.u);
+        }
+
+        // Convected quantities of the upwind side
+        const auto& K = M_half > T{0} ? L : R;
+        const T mdot = c_half * M_half * K.U.rho;
+        BasicConservativeVars<T, N> F{
+            mdot,
+            mdot * K.u + p_half,
+            mdot * (K.U.E + K.p) * K.inv_rho
+        };
+        F.for_each_scalar([&](auto k) { F.rho_phi[k] = mdot * K.U.rho_phi[k] * K.inv_rho; });
+        return F;
+    }
+};
+
+/// AUSM+ (Liou 1996)
+using AUSMPlusFlux = BasicAUSMPlusFlux<false>;
+
+/// AUSM+-up (Liou 2006) without low-Mach scaling
+using AUSMPlusUpFlux = BasicAUSMPlusFlux<true>;
+
+// =============================================================================
+// Hybrid flux selection
+// =============================================================================
+
+/**
+ * @brief Faces split by a jump sensor into a smooth and a flagged list
+ *
+ * classify() flags the faces across which density or pressure changes by
+ * more than a relative threshold, max(a, b) > (1 + threshold) * min(a, b),
+ * and widens every flag to the faces on either side, which covers the few
+ * cells of a captured shock or contact. The ratio test gives the same
+ * answer for rho as for 1/rho. The compaction writes each face to both
+ * lists and advances only the one it belongs to, so neither pass branches
+ * and the flux loops that follow run over their lists without a test.
+ * Face i lies between cells i and i + 1.
+ */
+struct FaceSelection {
+    ArenaVector<std::uint8_t> flagged;  ///< Sensor result per face, before widening
+    ArenaVector<int> smooth;            ///< Faces for the cheap flux
+    ArenaVector<int> sharp;             ///< Faces for the configured flux
+    std::size_t num_smooth = 0;
+    std::size_t num_sharp = 0;
+
+    void resize(std::size_t n) {
+        flagged.resize(n);
+        smooth.resize(n);
+        sharp.resize(n);
+    }
+
+    /**
+     * @brief Classify faces [first, last]
+     *
+     * rho(i) and p(i) return the density (or specific volume) and pressure
+     * of cell i; faces first - 1 and last + 1 are sensed as well, so cells
+     * first - 1 to last + 2 must exist.
+     */
+    template <typename T, typename Rho, typename P>
+    void classify(int first, int last, const Rho& rho, const P& p, T threshold) noexcept {
+        const T ratio = T{1} + threshold;
+        for (int i = first - 1; i <= last + 1; ++i) {
+            const T rho_L = rho(i);
+            const T rho_R = rho(i + 1);
+            const T p_L = p(i);
+            const T p_R = p(i + 1);
+            flagged[static_cast<std::size_t>(i)] =
+                static_cast<std::uint8_t>((std::max(rho_L, rho_R) > ratio * std::min(rho_L, rho_R)) |
+                                          (std::max(p_L, p_R) > ratio * std::min(p_L, p_R)));
+        }
+        num_smooth = 0;
+        num_sharp = 0;
+        for (int i = first; i <= last; ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            const std::size_t is_sharp = flagged[k - 1] | flagged[k] | flagged[k + 1];
+            smooth[num_smooth] = i;
+            sharp[num_sharp] = i;
+            num_smooth += 1 - is_sharp;
+            num_sharp += is_sharp;
+        }
+    }
+};
+
 // =============================================================================
 // Flux Variant for runtime selection
 // =============================================================================
 
 /// Variant holding all supported numerical flux schemes
-using FluxVariant = std::variant<LLFFlux, RusanovFlux, HLLFlux, HLLCFlux, MoversLEFlux>;
+using FluxVariant = std::variant<LLFFlux, RusanovFlux, HLLFlux, HLLCFlux, MoversLEFlux, StegerWarmingFlux,
+                                 VanLeerFlux, AUSMPlusFlux, AUSMPlusUpFlux, RoeFlux, HLLEFlux,
+                                 KurganovTadmorFlux>;
 
 /// Compute numerical flux using any flux scheme
-template <typename Eos>
-[[nodiscard]] inline ConservativeVars compute_flux(
+template <typename T, std::size_t N, typename Eos>
+[[nodiscard]] inline BasicConservativeVars<T, N> compute_flux(
     const FluxVariant& flux,
-    const ConservativeVars& U_L,
-    const ConservativeVars& U_R,
+    const BasicConservativeVars<T, N>& U_L,
+    const BasicConservativeVars<T, N>& U_R,
     const Eos& eos) {
     return std::visit([&](const auto& f) { return f(U_L, U_R, eos); }, flux);
 }
 
+/// Compute numerical flux from precomputed cell states using any flux scheme
+template <typename T, std::size_t N, typename Eos>
+[[nodiscard]] inline BasicConservativeVars<T, N> compute_flux(
+    const FluxVariant& flux,
+    const BasicCellState<T, N>& L,
+    const BasicCellState<T, N>& R,
+    const Eos& eos) {
+    return std::visit([&](const auto& f) { return f(L, R, eos); }, flux);
+}
+
 }  // namespace euler1d
 
 #endif  // EULER1D_FLUX_FLUX_HPP
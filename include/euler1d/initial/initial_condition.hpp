@@ -13,6 +13,7 @@
 #include "../eos/eos.hpp"
 #include <cmath>
 #include <span>
+#include <type_traits>
 #include <variant>
 
 namespace euler1d {
@@ -24,21 +25,27 @@ namespace euler1d {
 /**
  * @brief Piecewise constant initial condition
  *
- * Initializes solution with constant values in specified regions.
+ * Initializes solution with constant values in specified regions. Passive
+ * scalars missing from a region are zero.
  */
 struct PiecewiseConstantIC {
     std::vector<Region> regions;
 
-    template <typename Eos>
-    void apply(std::span<ConservativeVars> U, const Mesh1D& mesh, const Eos& eos) const {
+    template <typename Eos, typename T = typename Eos::value_type>
+    void apply(std::span<BasicConservativeVars<std::type_identity_t<T>>> U, const Mesh1D& mesh,
+               const Eos& eos) const {
         for (int i = 0; i < mesh.total_cells(); ++i) {
             const Real x = mesh.x(i);
 
             // Find which region this cell belongs to
-            PrimitiveVars W{Real{1}, Real{0}, Real{1}};  // Default
+            BasicPrimitiveVars<T> W{T{1}, T{0}, T{1}};  // Default
             for (const auto& region : regions) {
                 if (x >= region.x_left && x < region.x_right) {
-                    W = PrimitiveVars{region.rho, region.u, region.p};
+                    W = BasicPrimitiveVars<T>{static_cast<T>(region.rho), static_cast<T>(region.u),
+                                              static_cast<T>(region.p)};
+                    W.for_each_scalar([&](auto k) {
+                        W.phi[k] = k < region.scalars.size() ? static_cast<T>(region.scalars[k]) : T{0};
+                    });
                     break;
                 }
             }
@@ -57,21 +64,24 @@ struct PiecewiseConstantIC {
  *
  * Left of discontinuity: constant state
  * Right of discontinuity: sinusoidal density perturbation
+ * Passive scalars are zero.
  */
 struct ShockEntropyInteractionIC {
     Real discontinuity_position;
     ConstantState left_state;
     SinusoidalState right_state;
 
-    template <typename Eos>
-    void apply(std::span<ConservativeVars> U, const Mesh1D& mesh, const Eos& eos) const {
+    template <typename Eos, typename T = typename Eos::value_type>
+    void apply(std::span<BasicConservativeVars<std::type_identity_t<T>>> U, const Mesh1D& mesh,
+               const Eos& eos) const {
         for (int i = 0; i < mesh.total_cells(); ++i) {
             const Real x = mesh.x(i);
-            PrimitiveVars W;
+            BasicPrimitiveVars<T> W;
 
             if (x < discontinuity_position) {
                 // Constant left state
-                W = PrimitiveVars{left_state.rho, left_state.u, left_state.p};
+                W = BasicPrimitiveVars<T>{static_cast<T>(left_state.rho), static_cast<T>(left_state.u),
+                                          static_cast<T>(left_state.p)};
             } else {
                 // Sinusoidal right state
                 Real arg = right_state.rho_frequency * x;
@@ -79,7 +89,8 @@ struct ShockEntropyInteractionIC {
                     arg *= constants::pi;
                 }
                 const Real rho = right_state.rho_base + right_state.rho_amplitude * std::sin(arg);
-                W = PrimitiveVars{rho, right_state.u, right_state.p};
+                W = BasicPrimitiveVars<T>{static_cast<T>(rho), static_cast<T>(right_state.u),
+                                          static_cast<T>(right_state.p)};
             }
 
             U[static_cast<std::size_t>(i)] = eos.to_conservative(W);
@@ -94,10 +105,11 @@ struct ShockEntropyInteractionIC {
 /// Variant holding all supported initial conditions
 using InitialConditionVariant = std::variant<PiecewiseConstantIC, ShockEntropyInteractionIC>;
 
-/// Apply initial condition with any EOS
-template <typename Eos>
-void apply_initial_condition(const InitialConditionVariant& ic, std::span<ConservativeVars> U,
-                              const Mesh1D& mesh, const Eos& eos) {
+/// Apply initial condition with any EOS (the state precision follows the EOS)
+template <typename Eos, typename T = typename Eos::value_type>
+void apply_initial_condition(const InitialConditionVariant& ic,
+                             std::span<BasicConservativeVars<std::type_identity_t<T>>> U,
+                             const Mesh1D& mesh, const Eos& eos) {
     std::visit([&](const auto& condition) { condition.apply(U, mesh, eos); }, ic);
 }
 
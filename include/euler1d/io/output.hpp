@@ -1,6 +1,8 @@
 /**
  * @file output.hpp
  * @brief Output writers for the 1D Euler solver
+ *
+ * Writers are instantiated for float and double solutions.
  */
 
 #ifndef EULER1D_IO_OUTPUT_HPP
@@ -9,6 +11,7 @@
 #include "../core/types.hpp"
 #include "../mesh/mesh.hpp"
 #include <filesystem>
+#include <span>
 #include <string>
 
 namespace euler1d {
@@ -16,16 +19,17 @@ namespace euler1d {
 /**
  * @brief Write solution to CSV file
  *
- * Columns: x, rho, u, p, E
+ * Columns: x, rho, u, p, E, then phi1..phiK for the passive scalars
  *
  * @param path Output file path
  * @param mesh Computational mesh
- * @param U Conservative solution
+ * @param U Conservative solution, ghost cells included
  * @param W Primitive solution
  * @param time Current simulation time
  */
+template <typename T>
 void write_csv(const std::filesystem::path& path, const Mesh1D& mesh,
-               const ConservativeArray& U, const PrimitiveArray& W, Real time);
+               std::span<const BasicConservativeVars<T>> U, const BasicPrimitiveArray<T>& W, Real time);
 
 /**
  * @brief Write solution to VTK legacy format
@@ -34,12 +38,13 @@ void write_csv(const std::filesystem::path& path, const Mesh1D& mesh,
  *
  * @param path Output file path
  * @param mesh Computational mesh
- * @param U Conservative solution
+ * @param U Conservative solution, ghost cells included
  * @param W Primitive solution
  * @param time Current simulation time
  */
+template <typename T>
 void write_vtk(const std::filesystem::path& path, const Mesh1D& mesh,
-               const ConservativeArray& U, const PrimitiveArray& W, Real time);
+               std::span<const BasicConservativeVars<T>> U, const BasicPrimitiveArray<T>& W, Real time);
 
 }  // namespace euler1d
 
@@ -0,0 +1,268 @@
+/**
+ * @file block_tridiagonal.hpp
+ * @brief Direct solvers for block-tridiagonal systems with small dense blocks
+ *
+ * Row i of the system reads
+ *   lower[i] * x[i-1] + diag[i] * x[i] + upper[i] * x[i+1] = b[i],
+ * with lower[0] and upper[n-1] zero. The block Thomas algorithm solves it in
+ * O(n) sequential work; parallel cyclic reduction (PCR) takes O(n log n)
+ * work in log2(n) sweeps whose rows are independent and split over threads.
+ * Neither pivots between blocks, so the system should be block diagonally
+ * dominant (as implicit time steps of upwind schemes are).
+ */
+
+#ifndef EULER1D_LINEAR_BLOCK_TRIDIAGONAL_HPP
+#define EULER1D_LINEAR_BLOCK_TRIDIAGONAL_HPP
+
+#include "../memory/arena.hpp"
+#include "../parallel/communicator.hpp"
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace euler1d {
+
+/// Vector of one block row
+template <typename T, std::size_t N>
+using BasicBlockVector = std::array<T, N>;
+
+/// Dense N x N block, row-major
+template <typename T, std::size_t N>
+using BasicBlock = std::array<std::array<T, N>, N>;
+
+/// Block-tridiagonal matrix stored as three arrays of blocks
+template <typename T, std::size_t N>
+struct BasicBlockTridiagonal {
+    ArenaVector<BasicBlock<T, N>> lower;  ///< Coupling of row i to x[i-1] (lower[0] = 0)
+    ArenaVector<BasicBlock<T, N>> diag;   ///< Coupling of row i to x[i]
+    ArenaVector<BasicBlock<T, N>> upper;  ///< Coupling of row i to x[i+1] (upper[n-1] = 0)
+
+    void resize(std::size_t n) {
+        lower.resize(n);
+        diag.resize(n);
+        upper.resize(n);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return diag.size(); }
+};
+
+// =============================================================================
+// Block kernels
+// =============================================================================
+
+/// A * B
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr BasicBlock<T, N> block_multiply(const BasicBlock<T, N>& A,
+                                                        const BasicBlock<T, N>& B) noexcept {
+    BasicBlock<T, N> C{};
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t c = 0; c < N; ++c) {
+                C[r][c] += A[r][k] * B[k][c];
+            }
+        }
+    }
+    return C;
+}
+
+/// A * x
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr BasicBlockVector<T, N> block_multiply(const BasicBlock<T, N>& A,
+                                                              const BasicBlockVector<T, N>& x) noexcept {
+    BasicBlockVector<T, N> y{};
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            y[r] += A[r][c] * x[c];
+        }
+    }
+    return y;
+}
+
+/**
+ * @brief Inverse of A by Gauss-Jordan elimination with partial pivoting
+ *
+ * Works on local copies, so the compiler can keep the block in registers.
+ */
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr BasicBlock<T, N> block_inverse(BasicBlock<T, N> A) noexcept {
+    BasicBlock<T, N> inv{};
+    for (std::size_t k = 0; k < N; ++k) {
+        inv[k][k] = T{1};
+    }
+
+    for (std::size_t k = 0; k < N; ++k) {
+        std::size_t pivot = k;
+        for (std::size_t r = k + 1; r < N; ++r) {
+            if (std::abs(A[r][k]) > std::abs(A[pivot][k])) {
+                pivot = r;
+            }
+        }
+        if (pivot != k) {
+            std::swap(A[k], A[pivot]);
+            std::swap(inv[k], inv[pivot]);
+        }
+
+        const T inv_pivot = T{1} / A[k][k];
+        for (std::size_t c = 0; c < N; ++c) {
+            A[k][c] *= inv_pivot;
+            inv[k][c] *= inv_pivot;
+        }
+        for (std::size_t r = 0; r < N; ++r) {
+            if (r != k) {
+                const T factor = A[r][k];
+                for (std::size_t c = 0; c < N; ++c) {
+                    A[r][c] -= factor * A[k][c];
+                    inv[r][c] -= factor * inv[k][c];
+                }
+            }
+        }
+    }
+    return inv;
+}
+
+/// Overwrite each right-hand side (block or vector) with A^-1 times it
+template <typename T, std::size_t N, typename... Rhs>
+constexpr void block_solve(const BasicBlock<T, N>& A, Rhs&... rhs) noexcept {
+    const auto inv = block_inverse(A);
+    ((rhs = block_multiply(inv, rhs)), ...);
+}
+
+// =============================================================================
+// Block Thomas algorithm
+// =============================================================================
+
+/**
+ * @brief Solve A x = b by block LU without pivoting between blocks
+ *
+ * Overwrites b with x; the matrix is destroyed.
+ */
+template <typename T, std::size_t N>
+void solve_block_thomas(BasicBlockTridiagonal<T, N>& A, std::span<BasicBlockVector<T, N>> b) {
+    const std::size_t n = A.size();
+    if (n == 0) {
+        return;
+    }
+
+    // Forward sweep: upper[i] <- D_i'^-1 upper[i], b[i] <- D_i'^-1 (b[i] - lower[i] b[i-1])
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i > 0) {
+            const auto LU = block_multiply(A.lower[i], A.upper[i - 1]);
+            const auto Lb = block_multiply(A.lower[i], b[i - 1]);
+            for (std::size_t r = 0; r < N; ++r) {
+                for (std::size_t c = 0; c < N; ++c) {
+                    A.diag[i][r][c] -= LU[r][c];
+                }
+                b[i][r] -= Lb[r];
+            }
+        }
+        block_solve(A.diag[i], A.upper[i], b[i]);
+    }
+
+    // Back substitution
+    for (std::size_t i = n - 1; i-- > 0;) {
+        const auto Ux = block_multiply(A.upper[i], b[i + 1]);
+        for (std::size_t r = 0; r < N; ++r) {
+            b[i][r] -= Ux[r];
+        }
+    }
+}
+
+// =============================================================================
+// Parallel cyclic reduction
+// =============================================================================
+
+/**
+ * @brief Solve A x = b by parallel cyclic reduction
+ *
+ * Sweep s combines every row with rows i - s and i + s so that it couples
+ * to i - 2s and i + 2s only; after ceil(log2(n)) sweeps the rows are
+ * decoupled. Rows are split into contiguous chunks over `threads` threads,
+ * which meet at a barrier twice per sweep. Overwrites b with x; the matrix
+ * is destroyed.
+ */
+template <typename T, std::size_t N>
+void solve_block_pcr(BasicBlockTridiagonal<T, N>& A, std::span<BasicBlockVector<T, N>> b, int threads) {
+    const std::size_t n = A.size();
+    if (n == 0) {
+        return;
+    }
+    threads = std::clamp(threads, 1, static_cast<int>(std::min<std::size_t>(n, 1024)));
+
+    // Rows of the previous sweep premultiplied by D^-1: [D^-1 lower | D^-1 upper | D^-1 b]
+    ArenaVector<BasicBlock<T, N>> lower_hat(n);
+    ArenaVector<BasicBlock<T, N>> upper_hat(n);
+    ArenaVector<BasicBlockVector<T, N>> b_hat(n);
+
+    auto sweep = [&](int rank, auto&& sync) {
+        const std::size_t begin = n * static_cast<std::size_t>(rank) / static_cast<std::size_t>(threads);
+        const std::size_t end = n * static_cast<std::size_t>(rank + 1) / static_cast<std::size_t>(threads);
+
+        for (std::size_t s = 1; s < n; s *= 2) {
+            for (std::size_t i = begin; i < end; ++i) {
+                auto D = A.diag[i];
+                lower_hat[i] = A.lower[i];
+                upper_hat[i] = A.upper[i];
+                b_hat[i] = b[i];
+                block_solve(D, lower_hat[i], upper_hat[i], b_hat[i]);
+            }
+            sync();
+
+            for (std::size_t i = begin; i < end; ++i) {
+                BasicBlock<T, N> lower{};
+                BasicBlock<T, N> upper{};
+                if (i >= s) {
+                    // Eliminate x[i-s] with row i - s
+                    const auto& L = A.lower[i];
+                    const auto LL = block_multiply(L, lower_hat[i - s]);
+                    const auto LU = block_multiply(L, upper_hat[i - s]);
+                    const auto Lb = block_multiply(L, b_hat[i - s]);
+                    for (std::size_t r = 0; r < N; ++r) {
+                        for (std::size_t c = 0; c < N; ++c) {
+                            lower[r][c] = -LL[r][c];
+                            A.diag[i][r][c] -= LU[r][c];
+                        }
+                        b[i][r] -= Lb[r];
+                    }
+                }
+                if (i + s < n) {
+                    // Eliminate x[i+s] with row i + s
+                    const auto& U = A.upper[i];
+                    const auto UL = block_multiply(U, lower_hat[i + s]);
+                    const auto UU = block_multiply(U, upper_hat[i + s]);
+                    const auto Ub = block_multiply(U, b_hat[i + s]);
+                    for (std::size_t r = 0; r < N; ++r) {
+                        for (std::size_t c = 0; c < N; ++c) {
+                            upper[r][c] = -UU[r][c];
+                            A.diag[i][r][c] -= UL[r][c];
+                        }
+                        b[i][r] -= Ub[r];
+                    }
+                }
+                A.lower[i] = lower;
+                A.upper[i] = upper;
+            }
+            sync();
+        }
+
+        for (std::size_t i = begin; i < end; ++i) {
+            block_solve(A.diag[i], b[i]);
+        }
+    };
+
+    if (threads == 1) {
+        sweep(0, [] {});
+    } else {
+        std::barrier barrier(threads);
+        run_thread_ranks(threads, [&](int rank) { sweep(rank, [&barrier] { barrier.arrive_and_wait(); }); });
+    }
+}
+
+}  // namespace euler1d
+
+#endif  // EULER1D_LINEAR_BLOCK_TRIDIAGONAL_HPP
@@ -0,0 +1,205 @@
+/**
+ * @file arena.hpp
+ * @brief Bump arena for solver arrays and the aligned allocator drawing from it
+ *
+ * An Arena reserves one block of address space up front and hands out
+ * 64-byte-aligned pieces of it by bumping an offset. Freeing the most recent
+ * allocation rolls the offset back, so temporaries released in reverse order
+ * (the stage arrays of a step) reuse the same memory; any other free only
+ * drops the live count, and the space comes back with reset(). Pages are
+ * committed on first touch, and the block can be backed by transparent or
+ * explicit huge pages (see HugePages).
+ *
+ * ArenaAllocator serves containers from the arena that is current on the
+ * calling thread when they are created (see ArenaScope), or from the heap
+ * with the same alignment when there is none.
+ */
+
+#ifndef EULER1D_MEMORY_ARENA_HPP
+#define EULER1D_MEMORY_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace euler1d {
+
+/// Page backing of an arena reservation
+enum class HugePages {
+    None,         ///< Base pages, whatever the system default for transparent huge pages
+    Transparent,  ///< Advised for transparent huge pages (madvise(MADV_HUGEPAGE))
+    Explicit      ///< 2 MiB pages from the hugetlbfs pool (MAP_HUGETLB), else transparent
+};
+
+/**
+ * @brief Single reservation handing out aligned buffers, reset rather than freed
+ *
+ * Not thread-safe: use one arena per thread. Allocations that do not fit
+ * in the reservation are served by the heap and counted in Stats.
+ */
+class Arena {
+public:
+    /// Alignment of every allocation (one cache line, a full AVX-512 register)
+    static constexpr std::size_t alignment = 64;
+
+    /// Footprint statistics
+    struct Stats {
+        std::size_t capacity = 0;          ///< Bytes reserved
+        std::size_t in_use = 0;            ///< Bytes up to the bump offset, including freed holes
+        std::size_t peak = 0;              ///< Largest in_use so far; survives reset()
+        std::size_t live_allocations = 0;  ///< Allocations not yet freed
+        std::int64_t allocations = 0;      ///< Allocations served so far
+        std::size_t overflow_bytes = 0;    ///< Bytes served by the heap because the reservation was full
+        HugePages pages = HugePages::None; ///< Backing obtained (Explicit falls back to Transparent)
+    };
+
+    /// Resident memory of the reservation as reported by the kernel
+    struct PageUsage {
+        std::size_t resident_bytes = 0;   ///< Bytes committed so far
+        std::size_t huge_page_bytes = 0;  ///< Of which in huge pages (transparent or explicit)
+    };
+
+    /// Reserve capacity bytes (rounded up to the huge page size)
+    explicit Arena(std::size_t capacity, HugePages pages = HugePages::Transparent);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Aligned block of at least bytes bytes
+    [[nodiscard]] void* allocate(std::size_t bytes);
+
+    /// Return a block; rolls the offset back if it is the most recent one
+    void deallocate(void* p, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Make the whole reservation available again, keeping its pages
+     *
+     * @throws std::logic_error if an allocation is still live
+     */
+    void reset();
+
+    [[nodiscard]] Stats stats() const noexcept;
+
+    /**
+     * @brief Pages of the reservation that are resident, read from /proc/self/smaps
+     *
+     * Counts whole mappings overlapping the reservation, so a neighbouring
+     * anonymous mapping the kernel merged with it is included. All zero
+     * where smaps is not available.
+     */
+    [[nodiscard]] PageUsage page_usage() const;
+
+    /**
+     * @brief Fault in fresh pages from several threads (parallel first touch)
+     *
+     * From now on, the part of each allocation that reaches pages not touched
+     * before is split into threads contiguous slices, and slice k is touched
+     * by its own thread k. Under the first-touch policy, each slice then
+     * lives on the NUMA node of the thread that touched it, matching a
+     * decomposition into equal contiguous subdomains. Small blocks and 1
+     * thread are touched lazily by whoever writes them first.
+     */
+    void set_first_touch(int threads) noexcept { touch_threads_ = threads; }
+
+    /// Arena that new containers on this thread draw from (nullptr: the heap)
+    [[nodiscard]] static Arena* current() noexcept;
+
+private:
+    friend class ArenaScope;
+
+    [[nodiscard]] bool owns(const void* p) const noexcept;
+
+    /// Fault in the pages of [begin, end) from touch_threads_ threads
+    void first_touch(std::size_t begin, std::size_t end);
+
+    void* mapping_ = nullptr;  ///< Start of the reservation as obtained from the system
+    std::size_t mapping_size_ = 0;
+    std::byte* base_ = nullptr;  ///< First aligned byte handed out
+    std::size_t capacity_ = 0;
+    std::size_t offset_ = 0;
+    std::size_t peak_ = 0;
+    std::size_t live_ = 0;
+    std::int64_t allocations_ = 0;
+    std::size_t overflow_bytes_ = 0;
+    HugePages pages_ = HugePages::None;
+    int touch_threads_ = 1;
+    std::size_t touched_ = 0;  ///< Offset up to which pages have been faulted in
+};
+
+/**
+ * @brief Makes an arena current on this thread for the lifetime of the scope
+ *
+ * Scopes nest; nullptr selects the heap. The previous arena is restored on
+ * destruction.
+ */
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena* arena) noexcept;
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena* previous_;
+};
+
+/**
+ * @brief Allocator over an Arena, or the heap, with Arena::alignment
+ *
+ * A default-constructed allocator binds to Arena::current(), and so do the
+ * copies of a container; moves and swaps carry the arena along, copy
+ * assignment keeps the destination's.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept : arena_{Arena::current()} {}
+    explicit ArenaAllocator(Arena* arena) noexcept : arena_{arena} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_{other.arena()} {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        const std::size_t bytes = n * sizeof(T);
+        if (arena_ != nullptr) {
+            return static_cast<T*>(arena_->allocate(bytes));
+        }
+        return static_cast<T*>(::operator new(bytes, std::align_val_t{Arena::alignment}));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (arena_ != nullptr) {
+            arena_->deallocate(p, n * sizeof(T));
+        } else {
+            ::operator delete(p, std::align_val_t{Arena::alignment});
+        }
+    }
+
+    [[nodiscard]] ArenaAllocator select_on_container_copy_construction() const noexcept { return {}; }
+
+    [[nodiscard]] Arena* arena() const noexcept { return arena_; }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena();
+    }
+
+private:
+    Arena* arena_;
+};
+
+/// std::vector whose storage is aligned and comes from the current arena
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace euler1d
+
+#endif  // EULER1D_MEMORY_ARENA_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file mesh_hierarchy.hpp
+ * @brief Nested hierarchy of coarsened meshes and transfer kernels between levels
+ *
+ * Level l + 1 merges each pair of cells of level l, so coarse cell I covers
+ * fine cells 2I and 2I + 1 exactly. The kernels work on arrays laid out as
+ * [ghosts | interior | ghosts] like the solver's, touch interior cells only,
+ * and write into caller-provided storage so they never allocate.
+ */
+
+#ifndef EULER1D_MESH_MESH_HIERARCHY_HPP
+#define EULER1D_MESH_MESH_HIERARCHY_HPP
+
+#include "mesh.hpp"
+#include "../core/types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace euler1d {
+
+/**
+ * @brief Meshes of one domain, each with half the cells of the one before
+ *
+ * Level 0 is the given mesh. Coarsening stops after max_levels levels, or
+ * once the cell count is odd or halving it would leave fewer than min_cells.
+ */
+class MeshHierarchy {
+public:
+    MeshHierarchy(const Mesh1D& finest, int max_levels, int min_cells = 4);
+
+    /// Number of levels, including the finest
+    [[nodiscard]] int num_levels() const noexcept { return static_cast<int>(levels_.size()); }
+
+    /// Mesh of level l (0 = finest)
+    [[nodiscard]] const Mesh1D& level(int l) const noexcept { return levels_[static_cast<std::size_t>(l)]; }
+
+private:
+    std::vector<Mesh1D> levels_;
+};
+
+// =============================================================================
+// Transfer kernels
+// =============================================================================
+
+/**
+ * @brief Conservative restriction: each coarse cell gets the mean of its two fine cells
+ *
+ * Applies to cell averages and to rates such as dU/dt alike; the integral
+ * over every coarse cell is preserved. coarse_cells is the interior size of
+ * the coarse array.
+ */
+template <typename From, typename To, std::size_t N>
+void restrict_average(std::span<const BasicConservativeVars<From, N>> fine,
+                      std::span<BasicConservativeVars<To, N>> coarse, int coarse_cells) noexcept {
+    constexpr int ng = Mesh1D::num_ghosts;
+    for (int I = 0; I < coarse_cells; ++I) {
+        const auto& a = fine[static_cast<std::size_t>(ng + 2 * I)];
+        const auto& b = fine[static_cast<std::size_t>(ng + 2 * I + 1)];
+        auto& c = coarse[static_cast<std::size_t>(ng + I)];
+        for (std::size_t k = 0; k < N; ++k) {
+            c[k] = To{0.5} * (static_cast<To>(a[k]) + static_cast<To>(b[k]));
+        }
+    }
+}
+
+/// minmod(a, b) without branches: the smaller magnitude if the signs agree, else 0
+template <typename T>
+[[nodiscard]] inline T minmod(T a, T b) noexcept {
+    return (std::copysign(T{0.5}, a) + std::copysign(T{0.5}, b)) * std::min(std::abs(a), std::abs(b));
+}
+
+/**
+ * @brief Add a coarse-level correction to the fine level, piecewise linear with minmod slopes
+ *
+ * The two fine cells of coarse cell I receive delta_I -/+ s_I / 4, where s_I
+ * is the minmod of the one-sided differences of delta. Their mean is
+ * delta_I, so the correction is conservative, and the limiter adds no new
+ * extrema at shocks. Cells at the domain ends get zero slope.
+ */
+template <typename D, typename T, std::size_t N>
+void prolong_limited_add(std::span<const BasicConservativeVars<D, N>> coarse_delta,
+                         std::span<BasicConservativeVars<T, N>> fine, int coarse_cells) noexcept {
+    constexpr int ng = Mesh1D::num_ghosts;
+    for (int I = 0; I < coarse_cells; ++I) {
+        const auto& d = coarse_delta[static_cast<std::size_t>(ng + I)];
+        const auto& left = coarse_delta[static_cast<std::size_t>(ng + std::max(I - 1, 0))];
+        const auto& right = coarse_delta[static_cast<std::size_t>(ng + std::min(I + 1, coarse_cells - 1))];
+        auto& a = fine[static_cast<std::size_t>(ng + 2 * I)];
+        auto& b = fine[static_cast<std::size_t>(ng + 2 * I + 1)];
+        for (std::size_t k = 0; k < N; ++k) {
+            const D quarter_slope = D{0.25} * minmod(d[k] - left[k], right[k] - d[k]);
+            a[k] = static_cast<T>(static_cast<D>(a[k]) + d[k] - quarter_slope);
+            b[k] = static_cast<T>(static_cast<D>(b[k]) + d[k] + quarter_slope);
+        }
+    }
+}
+
+}  // namespace euler1d
+
+#endif  // EULER1D_MESH_MESH_HIERARCHY_HPP
@@ -0,0 +1,151 @@
+/**
+ * @file communicator.hpp
+ * @brief Communication layer for the domain-decomposed solver
+ *
+ * The solver talks to its neighbours only through a type satisfying the
+ * Communicator concept. MailboxCommunicator implements it on top of
+ * HaloMailbox arrays, which can live in ordinary memory (ranks are threads)
+ * or in a shared mapping (ranks are forked processes). A message-passing
+ * backend only has to provide the same four operations.
+ */
+
+#ifndef EULER1D_PARALLEL_COMMUNICATOR_HPP
+#define EULER1D_PARALLEL_COMMUNICATOR_HPP
+
+#include "halo_exchange.hpp"
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+
+namespace euler1d {
+
+/**
+ * @brief Operations the decomposed time loop needs from its transport
+ *
+ * - exchange_halos(U, from_left, from_right): publish the edge cells of the
+ *   ghost-padded local array U and fill its ghost layers from the left/right
+ *   neighbour (ranks form a ring, so rank 0's left neighbour is the last rank)
+ * - allreduce_max(x): maximum of x over all ranks
+ * - gather(owned, offset): store the owned interior cells at global cell
+ *   index `offset` of the assembled solution
+ */
+template <typename C, typename T>
+concept Communicator = requires(C comm, std::span<BasicConservativeVars<T>> U,
+                                std::span<const BasicConservativeVars<T>> owned) {
+    { comm.rank() } -> std::convertible_to<int>;
+    { comm.size() } -> std::convertible_to<int>;
+    comm.exchange_halos(U, true, true);
+    { comm.allreduce_max(0.0) } -> std::convertible_to<double>;
+    comm.gather(owned, 0);
+};
+
+/**
+ * @brief Communicator over an array of HaloMailbox shared by all ranks
+ *
+ * Every rank holds its own instance; the mailboxes and the gather buffer are
+ * shared. No locks are taken: see HaloMailbox for the ordering argument.
+ */
+template <typename T>
+class MailboxCommunicator {
+public:
+    using Conservative = BasicConservativeVars<T>;
+
+    MailboxCommunicator(std::span<HaloMailbox<T>> mailboxes, std::span<Conservative> gathered, int rank)
+        : mailboxes_{mailboxes}, gathered_{gathered}, rank_{rank} {}
+
+    [[nodiscard]] int rank() const noexcept { return rank_; }
+    [[nodiscard]] int size() const noexcept { return static_cast<int>(mailboxes_.size()); }
+
+    void exchange_halos(std::span<Conservative> U, bool from_left, bool from_right) {
+        constexpr int ng = Mesh1D::num_ghosts;
+        ++halo_sequence_;
+        own().publish_edges(U, halo_sequence_);
+        if (from_left) {
+            const auto& edge = neighbour(-1).right_edge_at(halo_sequence_);
+            std::copy(edge.begin(), edge.end(), U.begin());
+        }
+        if (from_right) {
+            const auto& edge = neighbour(+1).left_edge_at(halo_sequence_);
+            std::copy(edge.begin(), edge.end(), U.end() - ng);
+        }
+    }
+
+    [[nodiscard]] double allreduce_max(double value) {
+        ++reduce_sequence_;
+        own().publish_reduction(value, reduce_sequence_);
+        double result = value;
+        for (const auto& mailbox : mailboxes_) {
+            result = std::max(result, mailbox.reduction_at(reduce_sequence_));
+        }
+        return result;
+    }
+
+    void gather(std::span<const Conservative> owned, int offset) {
+        std::copy(owned.begin(), owned.end(), gathered_.begin() + offset);
+    }
+
+private:
+    [[nodiscard]] HaloMailbox<T>& own() { return mailboxes_[static_cast<std::size_t>(rank_)]; }
+
+    [[nodiscard]] const HaloMailbox<T>& neighbour(int direction) const {
+        const int n = size();
+        return mailboxes_[static_cast<std::size_t>((rank_ + direction + n) % n)];
+    }
+
+    std::span<HaloMailbox<T>> mailboxes_;
+    std::span<Conservative> gathered_;
+    int rank_;
+    std::uint64_t halo_sequence_ = 0;
+    std::uint64_t reduce_sequence_ = 0;
+};
+
+// =============================================================================
+// Rank launchers
+// =============================================================================
+
+/**
+ * @brief Run body(rank) for every rank on its own thread
+ *
+ * A rank that throws calls abort() (typically abort_ranks on the mailboxes)
+ * so that the others stop waiting for it. Returns when all ranks finish and
+ * rethrows the exception of the lowest failing rank, preferring one that is
+ * not RankAborted, if any.
+ */
+void run_thread_ranks(int num_ranks, const std::function<void(int)>& body,
+                      const std::function<void()>& abort = {});
+
+/**
+ * @brief Run body(rank) for every rank in its own process
+ *
+ * Ranks 1..n-1 are forked children; rank 0 runs in the calling process.
+ * Only memory mapped with SharedMemoryRegion before the call is visible
+ * across ranks. abort() is called when a rank throws or a child exits
+ * abnormally (for example killed by a signal). If a fork fails, the children
+ * already forked are killed. Rethrows an exception from rank 0 once the
+ * children have exited, unless it is RankAborted; throws std::runtime_error
+ * if a child fails.
+ */
+void run_process_ranks(int num_ranks, const std::function<void(int)>& body,
+                       const std::function<void()>& abort = {});
+
+/// Anonymous memory mapping shared with processes forked after its creation
+class SharedMemoryRegion {
+public:
+    explicit SharedMemoryRegion(std::size_t bytes);
+    ~SharedMemoryRegion();
+
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    [[nodiscard]] void* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+}  // namespace euler1d
+
+#endif  // EULER1D_PARALLEL_COMMUNICATOR_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file halo_exchange.hpp
+ * @brief Lock-free point-to-point halo exchange between subdomain ranks
+ *
+ * Each subdomain owns a HaloMailbox into which it publishes its edge cells
+ * and its all-reduce contributions. Neighbours read from it after observing the
+ * matching sequence number; there are no mutexes or global barriers. A rank
+ * that fails raises the abort flag of every mailbox, so that its neighbours
+ * stop waiting for messages that will never come.
+ */
+
+#ifndef EULER1D_PARALLEL_HALO_EXCHANGE_HPP
+#define EULER1D_PARALLEL_HALO_EXCHANGE_HPP
+
+#include "../core/types.hpp"
+#include "../mesh/mesh.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <thread>
+
+namespace euler1d {
+
+/// Cache line size assumed when padding shared flags
+inline constexpr std::size_t cache_line_size = 64;
+
+/// Thrown on the ranks that were waiting for a message when another rank aborted
+class RankAborted : public std::runtime_error {
+public:
+    RankAborted() : std::runtime_error("A neighbouring rank aborted") {}
+};
+
+/**
+ * @brief Spin until counter >= target, yielding the core after a short busy phase
+ *
+ * @return false if `aborted` was raised before the counter got there
+ */
+inline bool spin_wait_at_least(const std::atomic<std::uint64_t>& counter, std::uint64_t target,
+                               const std::atomic<bool>& aborted) noexcept {
+    int spins = 0;
+    while (counter.load(std::memory_order_acquire) < target) {
+        if (++spins > 128) {
+            if (aborted.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Edge cells and reduction value published by one subdomain
+ *
+ * Both payloads are double-buffered on the parity of their sequence number.
+ * The owner only reuses a buffer two sequences later, and it cannot get
+ * there before every reader has published the sequence in between, by which
+ * time that reader is done with the buffer. One monotonically increasing
+ * counter per payload is therefore all the synchronisation needed.
+ */
+template <typename T>
+struct alignas(cache_line_size) HaloMailbox {
+    static constexpr int num_ghosts = Mesh1D::num_ghosts;
+    using Edge = std::array<BasicConservativeVars<T>, static_cast<std::size_t>(num_ghosts)>;
+
+    std::array<Edge, 2> left_edge{};   ///< Leftmost interior cells
+    std::array<Edge, 2> right_edge{};  ///< Rightmost interior cells
+    alignas(cache_line_size) std::atomic<std::uint64_t> halo_sequence{0};
+
+    std::array<double, 2> reduction_value{};  ///< Contribution to an all-reduce
+    alignas(cache_line_size) std::atomic<std::uint64_t> reduction_sequence{0};
+
+    std::atomic<bool> aborted{false};  ///< Raised in every mailbox when any rank fails (see abort_ranks)
+
+    /// Publish the edge cells of U, laid out as [ghosts | interior | ghosts]
+    void publish_edges(std::span<const BasicConservativeVars<T>> U, std::uint64_t sequence) noexcept {
+        const auto slot = static_cast<std::size_t>(sequence % 2);
+        std::copy_n(U.begin() + num_ghosts, num_ghosts, left_edge[slot].begin());
+        std::copy_n(U.end() - 2 * num_ghosts, num_ghosts, right_edge[slot].begin());
+        halo_sequence.store(sequence, std::memory_order_release);
+    }
+
+    /// Leftmost interior cells at `sequence` (blocks until published; throws RankAborted)
+    [[nodiscard]] const Edge& left_edge_at(std::uint64_t sequence) const {
+        if (!spin_wait_at_least(halo_sequence, sequence, aborted)) {
+            throw RankAborted();
+        }
+        return left_edge[static_cast<std::size_t>(sequence % 2)];
+    }
+
+    /// Rightmost interior cells at `sequence` (blocks until published; throws RankAborted)
+    [[nodiscard]] const Edge& right_edge_at(std::uint64_t sequence) const {
+        if (!spin_wait_at_least(halo_sequence, sequence, aborted)) {
+            throw RankAborted();
+        }
+        return right_edge[static_cast<std::size_t>(sequence % 2)];
+    }
+
+    /// Publish this rank's contribution to all-reduce number `sequence`
+    void publish_reduction(double value, std::uint64_t sequence) noexcept {
+        reduction_value[static_cast<std::size_t>(sequence % 2)] = value;
+        reduction_sequence.store(sequence, std::memory_order_release);
+    }
+
+    /// Contribution to all-reduce number `sequence` (blocks until published; throws RankAborted)
+    [[nodiscard]] double reduction_at(std::uint64_t sequence) const {
+        if (!spin_wait_at_least(reduction_sequence, sequence, aborted)) {
+            throw RankAborted();
+        }
+        return reduction_value[static_cast<std::size_t>(sequence % 2)];
+    }
+};
+
+/// Raise the abort flag of every mailbox, releasing all ranks blocked on one of them
+template <typename T>
+void abort_ranks(std::span<HaloMailbox<T>> mailboxes) noexcept {
+    for (auto& mailbox : mailboxes) {
+        mailbox.aborted.store(true, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace euler1d
+
+#endif  // EULER1D_PARALLEL_HALO_EXCHANGE_HPP
@@ -23,8 +23,9 @@ namespace euler1d {
  * @brief No limiting - returns 0 (first order) or 1 (central diff)
  */
 struct NoLimiter {
-    [[nodiscard]] constexpr Real operator()(Real /*r*/) const noexcept {
-        return Real{0};  // First order
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(T /*r*/) const noexcept {
+        return T{0};  // First order
     }
 };
 
@@ -38,8 +39,9 @@ struct NoLimiter {
  * φ(r) = max(0, min(1, r))
  */
 struct MinmodLimiter {
-    [[nodiscard]] constexpr Real operator()(Real r) const noexcept {
-        return std::max(Real{0}, std::min(Real{1}, r));
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(T r) const noexcept {
+        return std::max(T{0}, std::min(T{1}, r));
     }
 };
 
@@ -53,8 +55,9 @@ struct MinmodLimiter {
  * φ(r) = (r + |r|) / (1 + |r|)
  */
 struct VanLeerLimiter {
-    [[nodiscard]] Real operator()(Real r) const noexcept {
-        return (r + std::abs(r)) / (Real{1} + std::abs(r));
+    template <typename T>
+    [[nodiscard]] T operator()(T r) const noexcept {
+        return (r + std::abs(r)) / (T{1} + std::abs(r));
     }
 };
 
@@ -68,8 +71,9 @@ struct VanLeerLimiter {
  * φ(r) = max(0, min(2r, 1), min(r, 2))
  */
 struct SuperbeeLimiter {
-    [[nodiscard]] constexpr Real operator()(Real r) const noexcept {
-        return std::max({Real{0}, std::min(Real{2} * r, Real{1}), std::min(r, Real{2})});
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(T r) const noexcept {
+        return std::max({T{0}, std::min(T{2} * r, T{1}), std::min(r, T{2})});
     }
 };
 
@@ -83,8 +87,9 @@ struct SuperbeeLimiter {
  * φ(r) = max(0, min(2r, (1+r)/2, 2))
  */
 struct MCLimiter {
-    [[nodiscard]] constexpr Real operator()(Real r) const noexcept {
-        return std::max(Real{0}, std::min({Real{2} * r, (Real{1} + r) / Real{2}, Real{2}}));
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(T r) const noexcept {
+        return std::max(T{0}, std::min({T{2} * r, (T{1} + r) / T{2}, T{2}}));
     }
 };
 
@@ -96,7 +101,8 @@ struct MCLimiter {
 using LimiterVariant = std::variant<NoLimiter, MinmodLimiter, VanLeerLimiter, SuperbeeLimiter, MCLimiter>;
 
 /// Apply limiter function
-[[nodiscard]] inline Real apply_limiter(const LimiterVariant& limiter, Real r) {
+template <typename T>
+[[nodiscard]] inline T apply_limiter(const LimiterVariant& limiter, T r) {
     return std::visit([r](const auto& lim) { return lim(r); }, limiter);
 }
 
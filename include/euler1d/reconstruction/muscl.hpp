@@ -12,6 +12,7 @@
 #include "../core/types.hpp"
 #include "../core/constants.hpp"
 #include "limiter.hpp"
+#include <algorithm>
 #include <span>
 #include <utility>
 
@@ -22,8 +23,13 @@ namespace euler1d {
  *
  * Reconstructs left and right states at cell interface i+1/2
  * using piecewise linear reconstruction with slope limiting.
+ *
+ * @tparam T Floating-point type of the primitive states
+ * @tparam N Components per state (passive scalars are limited like rho, u, p)
  */
-struct MUSCLReconstruction {
+template <typename T, std::size_t N = num_components>
+struct BasicMUSCLReconstruction {
+    using Primitive = BasicPrimitiveVars<T, N>;
 
     /**
      * @brief Reconstruct primitive variables at interface i+1/2
@@ -34,8 +40,8 @@ struct MUSCLReconstruction {
      * @return Pair of (W_L, W_R) at interface i+1/2
      */
     template <typename LimiterT>
-    [[nodiscard]] static std::pair<PrimitiveVars, PrimitiveVars> reconstruct(
-        std::span<const PrimitiveVars> W,
+    [[nodiscard]] static std::pair<Primitive, Primitive> reconstruct(
+        std::span<const Primitive> W,
         int i,
         const LimiterT& limiter) {
 
@@ -45,27 +51,27 @@ struct MUSCLReconstruction {
         const auto& W_ip1 = W[static_cast<std::size_t>(i + 1)];  // W_{i+1}
         const auto& W_ip2 = W[static_cast<std::size_t>(i + 2)];  // W_{i+2}
 
-        PrimitiveVars W_L, W_R;
+        Primitive W_L, W_R;
 
         // Component-wise reconstruction
-        for (std::size_t k = 0; k < PrimitiveVars::size(); ++k) {
+        for (std::size_t k = 0; k < Primitive::size(); ++k) {
             // Left state: extrapolate from cell i to right face
-            const Real delta_L = W_i[k] - W_im1[k];
-            const Real delta_R_left = W_ip1[k] - W_i[k];
-            const Real r_L = (std::abs(delta_R_left) > constants::epsilon)
+            const T delta_L = W_i[k] - W_im1[k];
+            const T delta_R_left = W_ip1[k] - W_i[k];
+            const T r_L = (std::abs(delta_R_left) > constants::epsilon_v<T>)
                 ? delta_L / delta_R_left
-                : Real{0};
-            const Real phi_L = limiter(r_L);
-            W_L[k] = W_i[k] + Real{0.5} * phi_L * delta_R_left;
+                : T{0};
+            const T phi_L = limiter(r_L);
+            W_L[k] = W_i[k] + T{0.5} * phi_L * delta_R_left;
 
             // Right state: extrapolate from cell i+1 to left face
-            const Real delta_L_right = W_ip1[k] - W_i[k];
-            const Real delta_R = W_ip2[k] - W_ip1[k];
-            const Real r_R = (std::abs(delta_L_right) > constants::epsilon)
+            const T delta_L_right = W_ip1[k] - W_i[k];
+            const T delta_R = W_ip2[k] - W_ip1[k];
+            const T r_R = (std::abs(delta_L_right) > constants::epsilon_v<T>)
                 ? delta_R / delta_L_right
-                : Real{0};
-            const Real phi_R = limiter(r_R);
-            W_R[k] = W_ip1[k] - Real{0.5} * phi_R * delta_L_right;
+                : T{0};
+            const T phi_R = limiter(r_R);
+            W_R[k] = W_ip1[k] - T{0.5} * phi_R * delta_L_right;
         }
 
         return {W_L, W_R};
@@ -74,25 +80,89 @@ struct MUSCLReconstruction {
     /**
      * @brief Reconstruct with runtime limiter variant
      */
-    [[nodiscard]] static std::pair<PrimitiveVars, PrimitiveVars> reconstruct(
-        std::span<const PrimitiveVars> W,
+    [[nodiscard]] static std::pair<Primitive, Primitive> reconstruct(
+        std::span<const Primitive> W,
         int i,
         const LimiterVariant& limiter) {
         return std::visit([&](const auto& lim) { return reconstruct(W, i, lim); }, limiter);
     }
+
+    /**
+     * @brief Limited half-slopes of all cells, for face states from cell_states()
+     *
+     * reconstruct() limits the slope of a cell once for each of its faces.
+     * Here it is limited once per cell and component:
+     *   dW_i = 1/2 phi(r_i) (W_{i+1} - W_i),  r_i = (W_i - W_{i-1}) / (W_{i+1} - W_i).
+     * The face of cell i+1 towards cell i uses phi(1/r_{i+1}) (W_{i+1} - W_i)
+     * in reconstruct(); the two agree for limiters with the symmetry
+     * phi(1/r) = phi(r) / r, which all of LimiterVariant have. The loop has
+     * no branches, so it vectorizes.
+     *
+     * @param W Array of primitive variables (including ghosts)
+     * @param dW Output half-slopes, same size as W (zero in the end cells)
+     * @param limiter Slope limiter to use
+     */
+    template <typename LimiterT>
+    static void limit_slopes(std::span<const Primitive> W, std::span<Primitive> dW, const LimiterT& limiter) {
+        const std::size_t n = W.size();
+        if (n < 3) {
+            std::fill(dW.begin(), dW.end(), Primitive{});
+            return;
+        }
+        dW[0] = Primitive{};
+        dW[n - 1] = Primitive{};
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            for (std::size_t k = 0; k < Primitive::size(); ++k) {
+                const T delta_L = W[i][k] - W[i - 1][k];
+                const T delta_R = W[i + 1][k] - W[i][k];
+                const bool resolved = std::abs(delta_R) > constants::epsilon_v<T>;
+                const T r = resolved ? delta_L / delta_R : T{0};
+                dW[i][k] = T{0.5} * limiter(r) * delta_R;
+            }
+        }
+    }
+
+    /**
+     * @brief Limited half-slopes with runtime limiter variant
+     */
+    static void limit_slopes(std::span<const Primitive> W, std::span<Primitive> dW, const LimiterVariant& limiter) {
+        std::visit([&](const auto& lim) { limit_slopes(W, dW, lim); }, limiter);
+    }
+
+    /**
+     * @brief Face states at interface i+1/2 from the half-slopes of limit_slopes()
+     *
+     * @return Pair of (W_L, W_R) at interface i+1/2
+     */
+    [[nodiscard]] static std::pair<Primitive, Primitive> cell_states(
+        std::span<const Primitive> W,
+        std::span<const Primitive> dW,
+        int i) noexcept {
+        const auto l = static_cast<std::size_t>(i);
+        return {W[l] + dW[l], W[l + 1] - dW[l + 1]};
+    }
 };
 
+/// MUSCL reconstruction in the default precision
+using MUSCLReconstruction = BasicMUSCLReconstruction<Real>;
+
 /**
  * @brief First-order reconstruction (no gradients)
  */
-struct FirstOrderReconstruction {
-    [[nodiscard]] static std::pair<PrimitiveVars, PrimitiveVars> reconstruct(
-        std::span<const PrimitiveVars> W,
+template <typename T, std::size_t N = num_components>
+struct BasicFirstOrderReconstruction {
+    using Primitive = BasicPrimitiveVars<T, N>;
+
+    [[nodiscard]] static std::pair<Primitive, Primitive> reconstruct(
+        std::span<const Primitive> W,
         int i) {
         return {W[static_cast<std::size_t>(i)], W[static_cast<std::size_t>(i + 1)]};
     }
 };
 
+/// First-order reconstruction in the default precision
+using FirstOrderReconstruction = BasicFirstOrderReconstruction<Real>;
+
 }  // namespace euler1d
 
 #endif  // EULER1D_RECONSTRUCTION_MUSCL_HPP
@@ -0,0 +1,59 @@
+/**
+ * @file positivity.hpp
+ * @brief Positivity-preserving limiting of reconstructed interface states
+ *
+ * Zhang & Shu, "On positivity-preserving high order discontinuous Galerkin
+ * schemes for compressible Euler equations", JCP 229 (2010).
+ */
+
+#ifndef EULER1D_RECONSTRUCTION_POSITIVITY_HPP
+#define EULER1D_RECONSTRUCTION_POSITIVITY_HPP
+
+#include "../core/types.hpp"
+#include "../core/constants.hpp"
+#include <algorithm>
+
+namespace euler1d {
+
+/// Whether density and pressure of W are above their floors
+template <typename T, std::size_t N>
+[[nodiscard]] constexpr bool is_positive(const BasicPrimitiveVars<T, N>& W) noexcept {
+    return W.rho >= constants::min_density_v<T> && W.p >= constants::min_pressure_v<T>;
+}
+
+/**
+ * @brief Pull a reconstructed face state towards its cell average until
+ *        density and pressure are positive
+ *
+ * W_face is replaced by W_cell + theta * (W_face - W_cell) with the largest
+ * theta in [0, 1] that keeps rho and p above min(floor, cell value). Faces
+ * that are already admissible are left untouched.
+ *
+ * @return true if the face state was scaled
+ */
+template <typename T, std::size_t N>
+[[nodiscard]] inline bool scale_to_positive(BasicPrimitiveVars<T, N>& W_face, const BasicPrimitiveVars<T, N>& W_cell) noexcept {
+    if (is_positive(W_face)) {
+        return false;
+    }
+
+    T theta = T{1};
+    auto limit = [&theta](T face, T cell, T floor) {
+        const T bound = std::min(floor, cell);
+        if (face < bound) {
+            theta = std::min(theta, (cell - bound) / (cell - face));
+        }
+    };
+    limit(W_face.rho, W_cell.rho, constants::min_density_v<T>);
+    limit(W_face.p, W_cell.p, constants::min_pressure_v<T>);
+
+    if (theta >= T{1}) {
+        return false;
+    }
+    W_face = W_cell + theta * (W_face - W_cell);
+    return true;
+}
+
+}  // namespace euler1d
+
+#endif  // EULER1D_RECONSTRUCTION_POSITIVITY_HPP
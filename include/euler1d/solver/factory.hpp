@@ -13,11 +13,14 @@
 #include "../boundary/boundary.hpp"
 #include "../time/time_integrator.hpp"
 #include "../initial/initial_condition.hpp"
+#include "../mesh/mesh.hpp"
+#include "../source/source.hpp"
 
 namespace euler1d {
 
-/// Create EOS from config
-EosVariant create_eos(const EosConfig& config);
+/// Create EOS from config (instantiated for float and double)
+template <typename T = Real>
+BasicEosVariant<T> create_eos(const EosConfig& config);
 
 /// Create flux scheme from enum
 FluxVariant create_flux(FluxScheme scheme);
@@ -31,6 +34,16 @@ BoundaryVariant create_boundary(BoundaryType type);
 /// Create time integrator from enum
 TimeIntegratorVariant create_time_integrator(TimeIntegrator integ);
 
+/**
+ * @brief Create source term from config (instantiated for float and double)
+ *
+ * The geometric source is tabulated on the cells of mesh.
+ *
+ * @throws ConfigError if the cross-section is not positive at an interior cell
+ */
+template <typename T = Real>
+BasicSourceVariant<T> create_source(const SourceConfig& config, const Mesh1D& mesh);
+
 }  // namespace euler1d
 
 #endif  // EULER1D_SOLVER_FACTORY_HPP
@@ -11,14 +11,24 @@
 #include "../mesh/mesh.hpp"
 #include "../eos/eos.hpp"
 #include "../flux/flux.hpp"
+#include "../reconstruction/ader.hpp"
 #include "../reconstruction/limiter.hpp"
 #include "../reconstruction/muscl.hpp"
 #include "../boundary/boundary.hpp"
 #include "../initial/initial_condition.hpp"
+#include "../linear/block_tridiagonal.hpp"
+#include "../source/source.hpp"
 #include "../time/time_integrator.hpp"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace euler1d {
 
@@ -27,17 +37,128 @@ namespace euler1d {
  *
  * Orchestrates mesh, EOS, flux scheme, reconstruction, boundaries,
  * time integration, and solution output.
+ *
+ * @tparam T   Storage precision of the solution arrays
+ * @tparam Acc Precision in which fluxes are evaluated and accumulated
+ *
+ * Instantiated for <double>, <float> and the mixed <float, double>.
  */
-class Solver {
+template <typename T, typename Acc = T>
+class BasicSolver {
 public:
-    /// Construct solver from configuration
-    explicit Solver(const Config& config);
+    using Conservative = BasicConservativeVars<T>;
+    using Primitive = BasicPrimitiveVars<T>;
+    using AccConservative = BasicConservativeVars<Acc>;
+
+    /**
+     * @brief Construct solver from configuration
+     *
+     * With an arena, the solution arrays, the workspaces and the temporaries
+     * of every step come from it (see ArenaScope); ranks of a decomposed run
+     * allocate on their own threads from the heap. The arena must outlive
+     * the solver and can be reset for the next one once it is destroyed.
+     * Without one, ExecutionConfig::huge_pages or ::first_touch make the
+     * solver reserve an arena of its own with that page placement.
+     */
+    explicit BasicSolver(const Config& config, Arena* arena = nullptr);
 
-    /// Run simulation to final time
+    /// Run simulation to final time (prints a summary when verbose)
     void run();
 
-    /// Get current solution (conservative variables)
-    [[nodiscard]] const ConservativeArray& solution() const noexcept { return U_; }
+    // -------------------------------------------------------------------------
+    // Stepping API for embedding the solver in a host code
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Advance the solution by one step of size dt
+     *
+     * dt is taken as given (see compute_dt for the CFL limit). Runs on the
+     * calling thread regardless of ExecutionConfig::threads.
+     *
+     * @throws std::invalid_argument if dt is not positive
+     */
+    void step(Real dt);
+
+    /**
+     * @brief Advance with CFL-limited steps until time t
+     *
+     * The last step is shortened to end exactly at t. Uses the configured
+     * subdomain ranks and the solution watchdog, like run().
+     */
+    void advance_to(Real t);
+
+    /**
+     * @brief Stable timestep for the current solution (CFL condition)
+     *
+     * @throws std::runtime_error if a cell is non-finite or non-physical
+     */
+    [[nodiscard]] Real compute_dt() const;
+
+    /// Outcome of solve_steady()
+    struct SteadyResult {
+        int iterations = 0;                      ///< Steps taken
+        bool converged = false;                  ///< Whether SteadyConfig::tolerance was reached
+        double relative_residual = 1.0;          ///< Residual of all components relative to its peak
+        BasicConservativeVars<double> residual;  ///< L2 norm of each component of dU/dt at the last iteration
+    };
+
+    /**
+     * @brief Iterate towards a steady state (see SteadyConfig)
+     *
+     * Every iteration is one step of the configured integrator. The L2 norm
+     * of dU/dt is accumulated while the first RHS evaluation of the step is
+     * computed, and the loop stops once the norm over all components has
+     * dropped by SteadyConfig::tolerance relative to its largest value so
+     * far (a solution at rest may start from zero residual), or after
+     * max_iterations. With local time stepping each cell advances at its own
+     * CFL limit, which makes time() a pseudo-time. Runs on the whole domain
+     * in the calling thread, with the solution watchdog; run() calls it when
+     * the steady mode is enabled.
+     */
+    SteadyResult solve_steady();
+
+    /**
+     * @brief Interior cells of the solution, writable in place
+     *
+     * Views U_ directly; valid for the lifetime of the solver, except that
+     * a step which grows the window of MeshConfig::expand moves and resizes
+     * it. Ghost cells are refilled from the interior at the start of every step.
+     */
+    [[nodiscard]] std::span<Conservative> interior() noexcept {
+        return std::span<Conservative>(U_).subspan(static_cast<std::size_t>(mesh_.first_interior()),
+                                                   static_cast<std::size_t>(mesh_.num_cells()));
+    }
+
+    /// Interior cells of the solution (read-only view)
+    [[nodiscard]] std::span<const Conservative> interior() const noexcept {
+        return std::span<const Conservative>(U_).subspan(static_cast<std::size_t>(mesh_.first_interior()),
+                                                         static_cast<std::size_t>(mesh_.num_cells()));
+    }
+
+    /**
+     * @brief Fit the window of MeshConfig::expand to the configured [xmin, xmax]
+     *
+     * Fills the configured cells the window has not reached with the far-field
+     * state, so that mesh() and solution() cover exactly the configured mesh. A no-op without expand.
+     * run() calls it when it finishes; stepping may continue afterwards.
+     */
+    void fit_window_to_domain();
+
+    /// Window counters of MeshConfig::expand
+    struct WindowStats {
+        int extensions = 0;  ///< Times the window grew
+        int peak_cells = 0;  ///< Largest number of interior cells stepped
+        int reallocations = 0;  ///< Times the window outgrew the headroom of its storage
+    };
+
+    /// Growth of the MeshConfig::expand window so far
+    [[nodiscard]] WindowStats window_stats() const noexcept { return window_stats_; }
+
+    /// Print progress and the run() summary to stdout (off by default)
+    void set_verbose(bool verbose) noexcept { verbose_ = verbose; }
+
+    /// Get current solution (conservative variables), ghost cells included
+    [[nodiscard]] std::span<const Conservative> solution() const noexcept { return U_; }
 
     /// Get mesh
     [[nodiscard]] const Mesh1D& mesh() const noexcept { return mesh_; }
@@ -45,18 +166,147 @@ public:
     /// Get current simulation time
     [[nodiscard]] Real time() const noexcept { return time_; }
 
+    /// Number of steps taken so far
+    [[nodiscard]] int steps() const noexcept { return steps_; }
+
+    /// Arena the solver allocates from (nullptr: the heap)
+    [[nodiscard]] Arena* arena() const noexcept { return arena_; }
+
+    /// Directory for per-rank output (ExecutionConfig::rank_output)
+    void set_output_dir(std::filesystem::path dir) { output_dir_ = std::move(dir); }
+
     /// Get test name from config
     [[nodiscard]] const std::string& test_name() const noexcept { return config_.simulation.test_name; }
 
     /// Convert solution to primitive variables
-    [[nodiscard]] PrimitiveArray to_primitive() const;
+    [[nodiscard]] BasicPrimitiveArray<T> to_primitive() const;
+
+    /// Integrals of (rho, rho*u, E) over the interior, accumulated in double
+    [[nodiscard]] BasicConservativeVars<double> conserved_totals() const;
+
+    /// Interface states and fluxes corrected by the positivity guard
+    struct PositivityCorrections {
+        std::int64_t limited_states = 0;  ///< Reconstructed states pulled towards the cell average
+        std::int64_t fallback_faces = 0;  ///< Faces that fell back to the first-order flux
+    };
+
+    /// Corrections made by the positivity guard so far (ranks in this process)
+    [[nodiscard]] PositivityCorrections positivity_corrections() const noexcept {
+        return {positivity_.limited_states.load(std::memory_order_relaxed),
+                positivity_.fallback_faces.load(std::memory_order_relaxed)};
+    }
+
+    /// Faces evaluated by each flux of the hybrid selection
+    struct HybridFaceCounts {
+        std::int64_t smooth_faces = 0;  ///< Faces given the LLF flux
+        std::int64_t sharp_faces = 0;   ///< Faces flagged by the sensor, given the configured flux
+    };
+
+    /// Faces evaluated by each flux of the hybrid selection so far (ranks in this process)
+    [[nodiscard]] HybridFaceCounts hybrid_face_counts() const noexcept {
+        return {hybrid_.smooth_faces.load(std::memory_order_relaxed),
+                hybrid_.sharp_faces.load(std::memory_order_relaxed)};
+    }
+
+    /// Interior cell updates of the steps taken by step()
+    struct CellUpdateCounts {
+        std::int64_t updated = 0;  ///< Cells swept by the integrator
+        std::int64_t skipped = 0;  ///< Quiescent cells left untouched (ExecutionConfig::active_regions)
+    };
+
+    /// Interior cell updates so far, and how many active-region tracking skipped
+    [[nodiscard]] CellUpdateCounts cell_update_counts() const noexcept { return cell_updates_; }
+
+    /// Human-readable precision mode ("double", "float" or "mixed")
+    [[nodiscard]] static constexpr const char* precision_name() noexcept {
+        if constexpr (!std::is_same_v<T, Acc>) {
+            return "mixed";
+        } else if constexpr (std::is_same_v<T, float>) {
+            return "float";
+        } else {
+            return "double";
+        }
+    }
 
 private:
+    /// Per-cell quantities evaluated once per cell and read by the faces on both sides
+    struct CellWorkspace {
+        BasicCellCache<Acc> states;       ///< Cell states of the first-order flux loop
+        BasicSplitFluxCache<Acc> split;   ///< F+ and F- of each cell (first order, vector splitting)
+        BasicRoeAverageCache<Acc> roe;    ///< Roe averages of each face (first order, Roe and HLLE)
+        BasicADERPredictor<Acc> ader;     ///< Predicted face states of ADER
+        FaceSelection faces;              ///< Smooth and flagged faces (hybrid flux)
+        ArenaVector<int> fallback_faces;  ///< Faces switched to first order (positivity guard)
+        BasicConservativeArray<T> stage;  ///< Stage input with boundaries applied (unsplit steps)
+    };
+
+    /// Size the parts of a cell workspace that the configured scheme uses for n cells
+    void size_cell_workspace(CellWorkspace& cells, std::size_t n) const;
+
     /// Compute RHS: dU/dt = -d(F)/dx
-    void compute_rhs(std::span<const ConservativeVars> U, std::span<ConservativeVars> dU);
+    void compute_rhs(std::span<const Conservative> U, std::span<AccConservative> dU, Acc dt);
 
-    /// Compute stable timestep based on CFL condition
-    [[nodiscard]] Real compute_dt() const;
+    /**
+     * @brief Compute RHS on any buffer laid out as [ghosts | interior | ghosts]
+     *
+     * Interior cells are [num_ghosts, U.size() - num_ghosts). W and fluxes are
+     * scratch of size U.size() and U.size() + 1; cells is sized by
+     * size_cell_workspace() for U.size(). At first order the cell states are
+     * precomputed into cells and W is left untouched; ADER predicts into
+     * cells as well. dW receives the limited half-slopes at second order
+     * with Slopes::Cell (size U.size(), unused otherwise). dt is the forward
+     * Euler step the RHS will be used with; it sizes the positivity check (0
+     * disables it) and, for MUSCLHancock and ADER, the predictor (0 gives the
+     * residual of the reconstruction alone). cell_offset maps indices of U to
+     * mesh cells for position-dependent sources, which are added here under
+     * SourceCoupling::Explicit. If residual_sq is given, the squares of the
+     * interior dU are added to it by the loop that completes them.
+     */
+    void compute_rhs(std::span<const Conservative> U, std::span<AccConservative> dU,
+                     std::span<Primitive> W, std::span<Primitive> dW, std::span<AccConservative> fluxes,
+                     CellWorkspace& cells, Acc dt, int cell_offset, AccConservative* residual_sq = nullptr) const;
+
+    /**
+     * @brief Split source step of Strang splitting on cells [first, last] of U
+     *
+     * Integrates dU/dt = S(U) over dt cell by cell; a no-op unless
+     * SourceCoupling::Strang. A step runs it over half the timestep before
+     * and after the flux update.
+     */
+    void split_source_step(std::span<Conservative> U, int first, int last, int cell_offset, Acc dt) const;
+
+    /**
+     * @brief Replace troubled interface fluxes by first-order fluxes
+     *
+     * Examines the faces of cells whose forward Euler update U + dt*dU is not
+     * admissible, switches the faces whose half-update fails to the
+     * first-order flux and recomputes dU for the cells next to them. The
+     * cell scan is skipped if scan_cells is false (every update admissible).
+     * residual_sq, if given, is kept in step with the recomputed dU.
+     *
+     * @return Number of faces switched
+     */
+    std::int64_t apply_flux_fallback(std::span<const Conservative> U, std::span<AccConservative> dU,
+                                     std::span<AccConservative> fluxes, CellWorkspace& cells, Acc dt,
+                                     bool scan_cells, AccConservative* residual_sq) const;
+
+    /// Result of the per-step scan of the solution
+    struct StateScan {
+        Acc max_speed = Acc{0};  ///< Maximum of |u| + c
+        int first_bad = -1;      ///< First non-finite or non-physical cell (-1 if all healthy)
+    };
+
+    /**
+     * @brief Maximum wave speed over cells [first, last] of U, with a health check
+     *
+     * The check (finite components, positive density and pressure) runs in the
+     * same pass on values already loaded for the wave speed. Finiteness is
+     * tested on the exponent bits, so it also holds under -ffast-math.
+     */
+    [[nodiscard]] StateScan scan_state(std::span<const Conservative> U, int first, int last) const;
+
+    /// CFL timestep for a given maximum wave speed
+    [[nodiscard]] Real dt_from_speed(Acc max_speed) const;
 
     /// Apply boundary conditions
     void apply_boundaries();
@@ -64,24 +314,306 @@ private:
     /// Convert solution to primitive variables (internal buffer)
     void update_primitives();
 
+    /**
+     * @brief Linear solve of the implicit integrators on the whole domain
+     *
+     * Overwrites the interior of b with the solution of (alpha*I - J) x = b,
+     * where J is the Jacobian of the first-order Rusanov residual at U
+     * (whatever the configured flux and order: the RHS keeps its accuracy
+     * and the implicit operator only has to be stable). Ghost cells are
+     * folded into the first and last rows for transmissive and reflective
+     * boundaries; periodic wrap-around coupling is left explicit.
+     */
+    void solve_linearized(std::span<const Conservative> U, Acc alpha, std::span<AccConservative> b);
+
+    /**
+     * @brief One steady-state iteration of dU/dt = R(U) + P on this solver's mesh
+     *
+     * P is the FAS forcing of the level (none on the finest). Takes one step
+     * of the configured integrator with the CFL timestep of max_speed times
+     * cfl_scale, or local timesteps (SteadyConfig::local_time_stepping).
+     * residual_sq, if given, receives the squares of R(U) at the start.
+     */
+    void steady_step(Acc max_speed, Real cfl_scale, AccConservative* residual_sq);
+
+    /**
+     * @brief FAS multigrid V-cycle (sawtooth) from this level down
+     *
+     * Smooths once, restricts the solution and builds the coarse forcing
+     * I(R + P) - R_c(I U), cycles on the next coarser level and adds back the
+     * prolonged coarse correction. Without a coarser level this is a single
+     * steady_step. A coarse level that turns non-physical contributes no
+     * correction.
+     */
+    void fas_cycle(Acc max_speed, Real cfl_scale, AccConservative* residual_sq);
+
+    /// Whether steps are executed tile by tile (see ExecutionConfig::tile_cells)
+    [[nodiscard]] bool use_tiling() const noexcept;
+
+    /**
+     * @brief Advance one step tile by tile
+     *
+     * Each tile is copied with a halo of num_ghosts cells per RK stage, all
+     * stages run on the cache-resident copy, and only the tile interior is
+     * written back. The old values of the trailing halo are carried over to
+     * the next tile, so U_ is updated in place.
+     */
+    void advance_tiled(Acc dt);
+
+    /**
+     * @brief Rollback state of the solution watchdog (one per time loop)
+     *
+     * A solution that passed scan_state is retained every few steps (every
+     * step while recovering). When scan_state flags a cell, the loop restores
+     * the retained solution and retries with half the CFL number until it is
+     * past the time of the failure again.
+     */
+    struct Watchdog {
+        /// Steps between retained solutions; copying U every step would cost more than the check
+        static constexpr int checkpoint_interval = 8;
+
+        BasicConservativeArray<T> U_good;  ///< Last solution that passed the scan
+        int first_good = 0;                ///< window_first_ of U_good, which a grown window extends
+        Real t_good = 0;
+        int step_good = 0;
+        Real t_failed = 0;   ///< Time at which the last failure was detected
+        Real cfl_scale = 1;  ///< Factor applied to the configured CFL number
+        int retries = 0;     ///< Rollbacks since the last failure was passed
+    };
+
+    /// Retain U (which passed scan_state) if a checkpoint is due; restores the full CFL once past the last failure
+    void watchdog_retain(Watchdog& watchdog, std::span<const Conservative> U, Real t, int step) const;
+
+    /**
+     * @brief Restore the last healthy solution and halve the CFL number
+     *
+     * bad_cell indexes the failing cell in U, or is -1 if it lies in another
+     * rank's subdomain (only the rank that found it logs it); cell_offset
+     * maps indices of U to the global mesh. A solution retained on a smaller
+     * MeshConfig::expand window is extended with its edge cells.
+     * Throws std::runtime_error, with U and t already restored, when
+     * TimeConfig::max_retries is exhausted, or if no healthy solution was
+     * ever retained.
+     */
+    void watchdog_roll_back(Watchdog& watchdog, std::span<Conservative> U, Real& t, int& step,
+                            int bad_cell, int cell_offset) const;
+
+    /// Whether two cells differ by more than rounding (momentum is measured against sqrt(rho * E))
+    [[nodiscard]] static bool cells_differ(const Conservative& a, const Conservative& b) noexcept;
+
+    /// Mesh of num_cells cells from cell `first` of the configured mesh on
+    [[nodiscard]] Mesh1D window_mesh(int first, int num_cells) const;
+
+    /// Cells of the configured mesh the MeshConfig::expand window starts on, as (first, count)
+    [[nodiscard]] std::pair<int, int> initial_window() const;
+
+    /**
+     * @brief Cells of the configured mesh to allocate for the window [first, first + num_cells), as (first, count)
+     *
+     * At least min_cells, with the headroom split evenly between the two
+     * sides and clamped to the configured mesh.
+     */
+    [[nodiscard]] std::pair<int, int> storage_range(int first, int num_cells, int min_cells) const;
+
+    /// Reserve the primitives, slopes, fluxes and cell workspace for `cells` cells, ghosts included
+    void reserve_workspaces(std::size_t cells);
+
+    /**
+     * @brief Grow the window to [first, first + num_cells), which contains the current one
+     *
+     * U_ grows in place inside U_storage_, and only the new cells are written:
+     * they take the far-field state, the first or last interior cell of the
+     * current window. Once the headroom runs out the storage is reallocated
+     * at twice its size, so the copies of all extensions total O(1) per cell.
+     */
+    void move_window(int first, int num_cells);
+
+    /**
+     * @brief Grow the MeshConfig::expand window where waves come near its edges
+     *
+     * A side grows once any of its outermost cells, a few stencil reaches
+     * deep, differs from the edge cell. It grows by at least half the window.
+     *
+     * @return Whether the window grew
+     */
+    bool expand_window();
+
+    /// Whether steps sweep only the active regions (see ExecutionConfig::active_regions)
+    [[nodiscard]] bool use_active_regions() const noexcept;
+
+    /**
+     * @brief Find the intervals of interior cells that the next step of size dt can change
+     *
+     * A face is disturbed where the cells on its two sides differ (ghost
+     * cells included, so a wall that reflects a moving gas counts). A cell
+     * changes only if a disturbed face lies within the stencil of all RK
+     * stages, ng cells per stage. The intervals get this margin plus the
+     * distance max|u| + c of the disturbed cells covers in dt, and are
+     * merged when they come within ng cells of each other.
+     */
+    void find_active_regions(Acc dt);
+
+    /**
+     * @brief Advance one step on the active regions only
+     *
+     * Each region is integrated in place with ng cells of the quiescent
+     * data on each side as ghost cells, which hold still through the
+     * stages and are restored afterwards. Cells outside the regions keep
+     * their values bit for bit.
+     */
+    void advance_active(Acc dt);
+
+    /// Time loop on the whole domain in the calling thread
+    void march_serial(Real t_final);
+
+    /// Number of subdomain ranks (see ExecutionConfig::threads and ::processes)
+    [[nodiscard]] int num_ranks() const noexcept;
+
+    /// Whether the RHS evolves the MUSCL face states over half a step (MUSCLHancock)
+    [[nodiscard]] bool hancock() const noexcept {
+        return std::holds_alternative<MUSCLHancock>(time_integrator_);
+    }
+
+    /// Whether the RHS is the one-step ADER scheme with its space-time predictor
+    [[nodiscard]] bool ader() const noexcept {
+        return std::holds_alternative<ADER>(time_integrator_);
+    }
+
+    /// Whether the flux splits per cell (flux vector splitting), which the first-order loop exploits
+    [[nodiscard]] bool split_flux() const noexcept {
+        return std::visit([](const auto& f) { return VectorSplitFlux<std::decay_t<decltype(f)>>; }, flux_);
+    }
+
+    /// Whether the flux takes Roe averages, which the first-order loop batches per face
+    [[nodiscard]] bool roe_averaged_flux() const noexcept {
+        return std::visit([](const auto& f) { return RoeAveragedFlux<std::decay_t<decltype(f)>>; }, flux_);
+    }
+
+    /**
+     * @brief Whether a shock sensor splits the faces between LLF and the configured flux
+     *
+     * Applies to the face-by-face flux loops; vector splitting, MUSCL-Hancock
+     * and ADER keep their own loops, and an LLF or Rusanov flux has nothing
+     * cheaper to fall back to.
+     */
+    [[nodiscard]] bool hybrid_flux() const noexcept {
+        return config_.numerics.hybrid_flux && !split_flux() && !hancock() && !ader() &&
+               !std::holds_alternative<LLFFlux>(flux_) && !std::holds_alternative<RusanovFlux>(flux_);
+    }
+
+    /// Whether MUSCL slopes are limited once per cell into a slope buffer (always for MUSCL-Hancock)
+    [[nodiscard]] bool cell_slopes() const noexcept {
+        return order_ >= 2 && !ader() && (config_.numerics.slopes == Slopes::Cell || hancock());
+    }
+
+    /**
+     * @brief Time loop with one rank per contiguous subdomain
+     *
+     * Ranks are threads, or forked processes sharing an anonymous mapping
+     * when ExecutionConfig::processes > 1. Every rank allocates its own
+     * arrays (so pages are first touched on its NUMA node), exchanges only
+     * edge cells with its two neighbours, and joins the others once per step
+     * for the timestep reduction. Periodic boundaries close the chain into a
+     * ring.
+     */
+    void march_decomposed(Real t_final);
+
+    /// Body of one rank in march_decomposed(); Comm satisfies Communicator
+    template <typename Comm>
+    void march_subdomain(Comm& comm, Real t_start, int step_start, Real t_final);
+
+    /// Arena reservation for the arrays and step temporaries of a solver or rank on `cells` cells
+    [[nodiscard]] static std::size_t arena_bytes(std::size_t cells) noexcept;
+
+    std::unique_ptr<Arena> owned_arena_;  ///< Arena for ExecutionConfig::huge_pages / ::first_touch
+    Arena* arena_ = nullptr;
     Config config_;
     Mesh1D mesh_;
-    EosVariant eos_;
+    BasicEosVariant<Acc> eos_;
     FluxVariant flux_;
     LimiterVariant limiter_;
     BoundaryVariant bc_left_;
     BoundaryVariant bc_right_;
     TimeIntegratorVariant time_integrator_;
     InitialConditionVariant initial_condition_;
+    BasicSourceVariant<Acc> source_;
 
-    ConservativeArray U_;       ///< Current solution (conservative)
-    PrimitiveArray W_;          ///< Current solution (primitive)
-    ConservativeArray fluxes_;  ///< Interface fluxes
+    BasicConservativeArray<T> U_storage_;  ///< U_ and the headroom of the MeshConfig::expand window
+    std::span<Conservative> U_;            ///< Current solution (conservative), a view of U_storage_
+    BasicPrimitiveArray<T> W_;             ///< Current solution (primitive)
+    BasicPrimitiveArray<T> dW_;            ///< Limited half-slopes (order 2, Slopes::Cell)
+    BasicConservativeArray<Acc> fluxes_;   ///< Interface fluxes
+    CellWorkspace cells_;                  ///< Per-cell flux inputs (first order, ADER)
+
+    /// Scratch buffers for tiled execution (sized to one tile plus halos)
+    struct TileWorkspace {
+        BasicConservativeArray<T> U;          ///< Tile solution
+        BasicConservativeArray<T> U_stage;    ///< Stage input with boundaries applied
+        BasicPrimitiveArray<T> W;             ///< Tile primitives
+        BasicPrimitiveArray<T> dW;            ///< Tile half-slopes
+        BasicConservativeArray<Acc> fluxes;   ///< Tile interface fluxes
+        CellWorkspace cells;                  ///< Tile per-cell flux inputs
+        BasicConservativeArray<T> carry;      ///< Pre-step values of the next tile's left halo
+        BasicConservativeArray<T> carry_next;
+    };
+    TileWorkspace tile_;
+
+    /// Active regions of the current step and their scratch (ExecutionConfig::active_regions)
+    struct ActiveWorkspace {
+        std::vector<std::pair<int, int>> regions;  ///< Interior cells [first, last) of each region
+        BasicConservativeArray<T> U_stage;         ///< Stage input with boundaries applied
+        BasicConservativeArray<T> edges;           ///< Ghost cells of a region before the step
+    };
+    ActiveWorkspace active_;
+    CellUpdateCounts cell_updates_;
+
+    int window_first_ = 0;   ///< Configured-mesh index of the first interior cell of mesh_ (MeshConfig::expand)
+    int storage_first_ = 0;  ///< Configured-mesh index of the first interior cell of U_storage_
+    WindowStats window_stats_;
+
+    /// Linear system and step history of the implicit integrators
+    struct ImplicitWorkspace {
+        BasicBlockTridiagonal<Acc, num_components> matrix;
+        ArenaVector<BasicBlockVector<Acc, num_components>> x;  ///< Right-hand side, then solution
+        BasicStepHistory<T, Acc> history;
+    };
+    ImplicitWorkspace implicit_;
+
+    /// Local timesteps and FAS multigrid levels of solve_steady()
+    struct SteadyWorkspace {
+        ArenaVector<Acc> dt_scale;                 ///< dt_i / dt of every cell (local time stepping)
+        std::unique_ptr<BasicSolver> coarse;       ///< Next coarser level, which owns the ones below it
+        BasicConservativeArray<Acc> forcing;       ///< FAS forcing P of this level (empty on the finest)
+        BasicConservativeArray<T> U_restricted;    ///< Solution as restricted from the finer level
+        BasicConservativeArray<Acc> rhs;           ///< R(U) + P, then the coarse correction
+    };
+    SteadyWorkspace steady_;
+
+    std::filesystem::path output_dir_{"."};
+
+    /// Positivity guard counters; compute_rhs is const and may run on several ranks
+    struct PositivityCounters {
+        mutable std::atomic<std::int64_t> limited_states{0};
+        mutable std::atomic<std::int64_t> fallback_faces{0};
+    };
+    PositivityCounters positivity_;
+
+    /// Hybrid flux counters, updated once per compute_rhs call
+    struct HybridCounters {
+        mutable std::atomic<std::int64_t> smooth_faces{0};
+        mutable std::atomic<std::int64_t> sharp_faces{0};
+    };
+    HybridCounters hybrid_;
 
     Real time_ = 0;
+    int steps_ = 0;
     int order_ = 1;
+    bool verbose_ = false;
 };
 
+/// Solver in the default precision
+using Solver = BasicSolver<Real>;
+
 }  // namespace euler1d
 
 #endif  // EULER1D_SOLVER_SOLVER_HPP
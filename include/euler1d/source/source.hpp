@@ -0,0 +1,240 @@
+/**
+ * @file source.hpp
+ * @brief Source terms S(U) of dU/dt + dF/dx = S(U)
+ *
+ * Each source provides the pointwise rate S(U) for unsplit (explicit)
+ * coupling and a local integrator of dU/dt = S(U) over a step for Strang
+ * splitting. The integrators are exact or implicit in the stiff part, so
+ * the split source step is stable for any step size.
+ * Uses std::variant for runtime polymorphism without virtual dispatch.
+ */
+
+#ifndef EULER1D_SOURCE_SOURCE_HPP
+#define EULER1D_SOURCE_SOURCE_HPP
+
+#include "../core/types.hpp"
+#include "../eos/eos.hpp"
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace euler1d {
+
+// =============================================================================
+// No Source
+// =============================================================================
+
+/// Homogeneous equations; skipped by the batched kernels below
+struct NoSource {};
+
+// =============================================================================
+// Geometric Source (quasi-1D area variation)
+// =============================================================================
+
+/**
+ * @brief Source of a duct with cross-section A(x)
+ *
+ * Dividing d(AU)/dt + d(AF)/dx = (0, p dA/dx, 0) by A gives
+ * S = -(A'/A) * rho*u * (1, u, H, phi_k) with H = (E + p)/rho. Covers
+ * quasi-1D nozzles as well as cylindrical (A = r) and spherical (A = r^2)
+ * symmetry.
+ *
+ * @tparam T Floating-point type of the states it operates on
+ */
+template <typename T>
+struct BasicGeometricSource {
+    std::vector<T> area_ratio;  ///< A'(x)/A(x) at each mesh cell centre (0 in ghost cells)
+
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> rate(const BasicConservativeVars<T, N>& U, std::size_t cell,
+                                                  const Eos& eos) const noexcept {
+        const T a = area_ratio[cell];
+        const T u = U.rho_u / U.rho;
+        const T p = eos.pressure(U);
+        BasicConservativeVars<T, N> S{-a * U.rho_u, -a * U.rho_u * u, -a * (U.E + p) * u};
+        S.for_each_scalar([&](auto k) { S.rho_phi[k] = -a * U.rho_phi[k] * u; });
+        return S;
+    }
+
+    /**
+     * @brief Integrate dU/dt = S(U) over dt with the velocity frozen
+     *
+     * Momentum and mass share the decay rate a*u, so u is constant and the
+     * density decays as exp(-a*u*dt). The internal energy decays as
+     * exp(-a*u*dt * (1 + p/rho e)), exactly for an ideal gas, which keeps
+     * density and pressure positive for any dt.
+     */
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> integrate(const BasicConservativeVars<T, N>& U, std::size_t cell,
+                                                       T dt, const Eos& eos) const noexcept {
+        const T decay = area_ratio[cell] * (U.rho_u / U.rho) * dt;
+        const T kinetic = T{0.5} * U.rho_u * U.rho_u / U.rho;
+        const T internal = U.E - kinetic;
+        const T ratio = std::exp(-decay);
+        const T internal_ratio = std::exp(-decay * (T{1} + eos.pressure(U) / internal));
+        BasicConservativeVars<T, N> result{U.rho * ratio, U.rho_u * ratio,
+                                           kinetic * ratio + internal * internal_ratio};
+        result.for_each_scalar([&](auto k) { result.rho_phi[k] = U.rho_phi[k] * ratio; });
+        return result;
+    }
+};
+
+// =============================================================================
+// Gravity Source
+// =============================================================================
+
+/**
+ * @brief Constant body force: S = (0, rho*g, rho*u*g)
+ *
+ * @tparam T Floating-point type of the states it operates on
+ */
+template <typename T>
+struct BasicGravitySource {
+    T g;  ///< Acceleration along +x
+
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> rate(const BasicConservativeVars<T, N>& U, std::size_t /*cell*/,
+                                                  const Eos& /*eos*/) const noexcept {
+        return BasicConservativeVars<T, N>{T{0}, U.rho * g, U.rho_u * g};
+    }
+
+    /// Exact: rho is constant, so rho*u grows linearly and E quadratically
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> integrate(BasicConservativeVars<T, N> U, std::size_t /*cell*/,
+                                                       T dt, const Eos& /*eos*/) const noexcept {
+        const T dv = g * dt;
+        U.E += dv * (U.rho_u + T{0.5} * U.rho * dv);
+        U.rho_u += U.rho * dv;
+        return U;
+    }
+};
+
+// =============================================================================
+// One-Step Reaction Source
+// =============================================================================
+
+/**
+ * @brief Irreversible Arrhenius reaction consuming passive scalar 0
+ *
+ * The reactant mass fraction Y = phi_0 is consumed at the rate
+ * omega = K * rho*Y * exp(-T_a / theta), with theta = p/rho, and releases
+ * q per unit mass into the total energy:
+ * S_rhoY = -omega, S_E = q * omega.
+ * Requires at least one passive scalar (EULER1D_NUM_SCALARS > 0).
+ *
+ * @tparam T Floating-point type of the states it operates on
+ */
+template <typename T>
+struct BasicReactionSource {
+    T rate_constant;           ///< Pre-exponential factor K
+    T activation_temperature;  ///< T_a
+    T heat_release;            ///< q
+
+    /// Rate coefficient K * exp(-T_a / theta) of the state
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] T coefficient(const BasicConservativeVars<T, N>& U, const Eos& eos) const noexcept {
+        const T theta = eos.pressure(U) / U.rho;
+        return rate_constant * std::exp(-activation_temperature / theta);
+    }
+
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> rate(const BasicConservativeVars<T, N>& U, std::size_t /*cell*/,
+                                                  const Eos& eos) const noexcept {
+        BasicConservativeVars<T, N> S{};
+        if constexpr (N > 3) {
+            const T omega = coefficient(U, eos) * U.rho_phi[0];
+            S.rho_phi[0] = -omega;
+            S.E = heat_release * omega;
+        }
+        return S;
+    }
+
+    /**
+     * @brief Backward Euler with the rate coefficient frozen at the start
+     *
+     * Linear in rho*Y, so the implicit step is solved in closed form; it
+     * stays in [0, rho*Y] however stiff the reaction. The energy released
+     * matches the reactant consumed.
+     */
+    template <std::size_t N, typename Eos>
+    [[nodiscard]] BasicConservativeVars<T, N> integrate(BasicConservativeVars<T, N> U, std::size_t /*cell*/,
+                                                       T dt, const Eos& eos) const noexcept {
+        if constexpr (N > 3) {
+            const T reactant = U.rho_phi[0] / (T{1} + dt * coefficient(U, eos));
+            U.E += heat_release * (U.rho_phi[0] - reactant);
+            U.rho_phi[0] = reactant;
+        }
+        return U;
+    }
+};
+
+// =============================================================================
+// Source Variant and batched kernels
+// =============================================================================
+
+/// Variant holding all supported source terms
+template <typename T>
+using BasicSourceVariant = std::variant<NoSource, BasicGeometricSource<T>, BasicGravitySource<T>,
+                                        BasicReactionSource<T>>;
+
+using SourceVariant = BasicSourceVariant<Real>;
+
+/**
+ * @brief Add S(U_i) to dU_i for cells [first, last] of U
+ *
+ * U may be stored in a lower precision than the source (Acc); cell_offset
+ * maps indices of U to mesh cells. If residual_sq is given, the squares of
+ * the completed dU_i are added to it in the same pass.
+ */
+template <typename T, typename Acc, std::size_t N>
+inline void add_source(const BasicSourceVariant<Acc>& source, const BasicEosVariant<Acc>& eos,
+                       std::span<const BasicConservativeVars<T, N>> U, std::span<BasicConservativeVars<Acc, N>> dU,
+                       int first, int last, int cell_offset, BasicConservativeVars<Acc, N>* residual_sq = nullptr) {
+    if (std::holds_alternative<NoSource>(source)) {
+        return;
+    }
+    std::visit([&](const auto& src) {
+        if constexpr (!std::is_same_v<std::decay_t<decltype(src)>, NoSource>) {
+            std::visit([&](const auto& e) {
+                for (int i = first; i <= last; ++i) {
+                    const auto U_i = precision_cast<Acc>(U[static_cast<std::size_t>(i)]);
+                    auto& dU_i = dU[static_cast<std::size_t>(i)];
+                    dU_i += src.rate(U_i, static_cast<std::size_t>(i + cell_offset), e);
+                    if (residual_sq) {
+                        accumulate_squares(*residual_sq, dU_i);
+                    }
+                }
+            }, eos);
+        }
+    }, source);
+}
+
+/**
+ * @brief Advance cells [first, last] of U by dU/dt = S(U) over dt
+ *
+ * The split source step of Strang splitting; see add_source for cell_offset.
+ */
+template <typename T, typename Acc, std::size_t N>
+inline void integrate_source(const BasicSourceVariant<Acc>& source, const BasicEosVariant<Acc>& eos,
+                             std::span<BasicConservativeVars<T, N>> U, int first, int last, int cell_offset, Acc dt) {
+    if (std::holds_alternative<NoSource>(source)) {
+        return;
+    }
+    std::visit([&](const auto& src) {
+        if constexpr (!std::is_same_v<std::decay_t<decltype(src)>, NoSource>) {
+            std::visit([&](const auto& e) {
+                for (int i = first; i <= last; ++i) {
+                    auto& U_i = U[static_cast<std::size_t>(i)];
+                    U_i = precision_cast<T>(src.integrate(precision_cast<Acc>(U_i),
+                                                          static_cast<std::size_t>(i + cell_offset), dt, e));
+                }
+            }, eos);
+        }
+    }, source);
+}
+
+}  // namespace euler1d
+
+#endif  // EULER1D_SOURCE_SOURCE_HPP
@@ -1,20 +1,50 @@
 /**
  * @file time_integrator.hpp
  * @brief Time integration schemes for the 1D Euler solver
+ *
+ * Integrators are templated on the storage precision T of the solution and
+ * the accumulation precision Acc of the RHS. Stage combinations are formed
+ * in Acc and rounded to T once per stage, so a float-stored solution can be
+ * advanced with double-precision updates.
  */
 
 #ifndef EULER1D_TIME_TIME_INTEGRATOR_HPP
 #define EULER1D_TIME_TIME_INTEGRATOR_HPP
 
 #include "../core/types.hpp"
+#include <algorithm>
 #include <functional>
 #include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <variant>
 
 namespace euler1d {
 
-/// Type alias for the RHS function: computes dU/dt given U
-using RhsFunction = std::function<void(std::span<const ConservativeVars>, std::span<ConservativeVars>)>;
+/// Type alias for the RHS function: computes dU/dt (precision Acc) given U (precision T)
+template <typename T, typename Acc = T>
+using BasicRhsFunction = std::function<void(std::span<const BasicConservativeVars<T>>,
+                                            std::span<BasicConservativeVars<Acc>>)>;
+
+/// RHS function in the default precision
+using RhsFunction = BasicRhsFunction<Real>;
+
+/**
+ * @brief Linear solve of the implicit integrators
+ *
+ * Called as solve(U, alpha, b): overwrites b with the solution x of
+ * (alpha*I - J) x = b, where J approximates the Jacobian of the RHS at U.
+ */
+template <typename T, typename Acc = T>
+using BasicLinearSolveFunction = std::function<void(std::span<const BasicConservativeVars<T>>, Acc,
+                                                    std::span<BasicConservativeVars<Acc>>)>;
+
+/// Solution history kept between steps by multistep integrators
+template <typename T, typename Acc = T>
+struct BasicStepHistory {
+    BasicConservativeArray<T> U_prev;  ///< Solution before the last step (empty until one is taken)
+    Acc dt_prev{0};                    ///< Size of the last step
+};
 
 // =============================================================================
 // Explicit (Forward) Euler
@@ -26,18 +56,26 @@ using RhsFunction = std::function<void(std::span<const ConservativeVars>, std::s
  * U^{n+1} = U^n + dt * L(U^n)
  */
 struct ExplicitEuler {
-    void advance(std::span<ConservativeVars> U, Real dt, const RhsFunction& rhs) const {
+    static constexpr int num_stages = 1;  ///< RHS evaluations per step
+    static constexpr bool is_implicit = false;
+
+    template <typename T, typename Acc>
+    void advance(std::span<BasicConservativeVars<T>> U, Acc dt, const BasicRhsFunction<T, Acc>& rhs) const {
         const std::size_t n = U.size();
-        ConservativeArray dU(n);
+        BasicConservativeArray<Acc> dU(n);
 
         // Compute RHS
         rhs(U, dU);
 
         // Update solution
         for (std::size_t i = 0; i < n; ++i) {
-            U[i] += dt * dU[i];
+            U[i] = precision_cast<T>(precision_cast<Acc>(U[i]) + dt * dU[i]);
         }
     }
+
+    void advance(std::span<ConservativeVars> U, Real dt, const RhsFunction& rhs) const {
+        advance<Real, Real>(U, dt, rhs);
+    }
 };
 
 // =============================================================================
@@ -55,14 +93,18 @@ struct ExplicitEuler {
  * U^(n+1) = 1/3 * U^n + 2/3 * U^(2) + 2/3 * dt * L(U^(2))
  */
 struct SSPRK3 {
-    void advance(std::span<ConservativeVars> U, Real dt, const RhsFunction& rhs) const {
+    static constexpr int num_stages = 3;  ///< RHS evaluations per step
+    static constexpr bool is_implicit = false;
+
+    template <typename T, typename Acc>
+    void advance(std::span<BasicConservativeVars<T>> U, Acc dt, const BasicRhsFunction<T, Acc>& rhs) const {
         const std::size_t n = U.size();
 
         // Storage for stages
-        ConservativeArray U_n(n);     // U^n
-        ConservativeArray U_1(n);     // U^(1)
-        ConservativeArray U_2(n);     // U^(2)
-        ConservativeArray dU(n);      // RHS
+        BasicConservativeArray<T> U_n(n);     // U^n
+        BasicConservativeArray<T> U_1(n);     // U^(1)
+        BasicConservativeArray<T> U_2(n);     // U^(2)
+        BasicConservativeArray<Acc> dU(n);    // RHS
 
         // Save initial state
         std::copy(U.begin(), U.end(), U_n.begin());
@@ -70,19 +112,126 @@ struct SSPRK3 {
         // Stage 1: U^(1) = U^n + dt * L(U^n)
         rhs(U, dU);
         for (std::size_t i = 0; i < n; ++i) {
-            U_1[i] = U_n[i] + dt * dU[i];
+            U_1[i] = precision_cast<T>(precision_cast<Acc>(U_n[i]) + dt * dU[i]);
         }
 
         // Stage 2: U^(2) = 3/4 * U^n + 1/4 * U^(1) + 1/4 * dt * L(U^(1))
         rhs(U_1, dU);
         for (std::size_t i = 0; i < n; ++i) {
-            U_2[i] = Real{0.75} * U_n[i] + Real{0.25} * U_1[i] + Real{0.25} * dt * dU[i];
+            U_2[i] = precision_cast<T>(Acc{0.75} * precision_cast<Acc>(U_n[i]) +
+                                       Acc{0.25} * precision_cast<Acc>(U_1[i]) + Acc{0.25} * dt * dU[i]);
         }
 
         // Stage 3: U^(n+1) = 1/3 * U^n + 2/3 * U^(2) + 2/3 * dt * L(U^(2))
         rhs(U_2, dU);
+        const Acc one_third = static_cast<Acc>(1.0 / 3.0);
+        const Acc two_thirds = static_cast<Acc>(2.0 / 3.0);
+        for (std::size_t i = 0; i < n; ++i) {
+            U[i] = precision_cast<T>(one_third * precision_cast<Acc>(U_n[i]) +
+                                     two_thirds * precision_cast<Acc>(U_2[i]) + two_thirds * dt * dU[i]);
+        }
+    }
+
+    void advance(std::span<ConservativeVars> U, Real dt, const RhsFunction& rhs) const {
+        advance<Real, Real>(U, dt, rhs);
+    }
+};
+
+// =============================================================================
+// MUSCL-Hancock
+// =============================================================================
+
+/**
+ * @brief MUSCL-Hancock predictor-corrector (second order, one stage)
+ *
+ * U^{n+1} = U^n + dt * L_H(U^n), where L_H takes the fluxes between MUSCL
+ * face states evolved over dt/2 by the flux difference across their cell
+ * (Toro, "Riemann Solvers and Numerical Methods for Fluid Dynamics", 14.4).
+ * The update is that of forward Euler; the solver supplies L_H as the RHS
+ * for this integrator, so it needs MUSCL reconstruction.
+ */
+struct MUSCLHancock : ExplicitEuler {};
+
+// =============================================================================
+// ADER
+// =============================================================================
+
+/**
+ * @brief One-step third-order ADER scheme
+ *
+ * U^{n+1} = U^n + dt * L_A(U^n), where L_A takes one Riemann solve per face
+ * between face states that a cell-local space-time predictor has averaged
+ * over the step (see BasicADERPredictor). As for MUSCLHancock, the update is
+ * that of forward Euler and the solver supplies L_A as the RHS.
+ */
+struct ADER : ExplicitEuler {};
+
+// =============================================================================
+// Linearized Backward Euler
+// =============================================================================
+
+/**
+ * @brief Backward Euler linearized about U^n (first order, implicit)
+ *
+ * One Newton step of U^{n+1} = U^n + dt * L(U^{n+1}):
+ * (I/dt - J) dU = L(U^n),  U^{n+1} = U^n + dU
+ */
+struct BackwardEuler {
+    static constexpr int num_stages = 1;  ///< RHS evaluations per step
+    static constexpr bool is_implicit = true;
+
+    template <typename T, typename Acc>
+    void advance(std::span<BasicConservativeVars<T>> U, Acc dt, const BasicRhsFunction<T, Acc>& rhs,
+                 const BasicLinearSolveFunction<T, Acc>& solve, BasicStepHistory<T, Acc>& /*history*/) const {
+        const std::size_t n = U.size();
+        BasicConservativeArray<Acc> dU(n);
+
+        rhs(U, dU);
+        solve(U, Acc{1} / dt, dU);
+
         for (std::size_t i = 0; i < n; ++i) {
-            U[i] = Real{1.0 / 3.0} * U_n[i] + Real{2.0 / 3.0} * U_2[i] + Real{2.0 / 3.0} * dt * dU[i];
+            U[i] = precision_cast<T>(precision_cast<Acc>(U[i]) + dU[i]);
+        }
+    }
+};
+
+// =============================================================================
+// Linearized BDF2
+// =============================================================================
+
+/**
+ * @brief Variable-step BDF2 linearized about U^n (implicit)
+ *
+ * With w = dt / dt_prev, a0 = (1 + 2w)/(1 + w) and c = w^2/(1 + w):
+ * (a0/dt * I - J) dU = L(U^n) + c/dt * (U^n - U^{n-1}),  U^{n+1} = U^n + dU
+ * The first step, without history, is a backward Euler step.
+ */
+struct BDF2 {
+    static constexpr int num_stages = 1;  ///< RHS evaluations per step
+    static constexpr bool is_implicit = true;
+
+    template <typename T, typename Acc>
+    void advance(std::span<BasicConservativeVars<T>> U, Acc dt, const BasicRhsFunction<T, Acc>& rhs,
+                 const BasicLinearSolveFunction<T, Acc>& solve, BasicStepHistory<T, Acc>& history) const {
+        const std::size_t n = U.size();
+        BasicConservativeArray<Acc> dU(n);
+
+        rhs(U, dU);
+        Acc a0{1};
+        if (history.U_prev.size() == n) {
+            const Acc w = dt / history.dt_prev;
+            a0 = (Acc{1} + Acc{2} * w) / (Acc{1} + w);
+            const Acc c_dt = w * w / ((Acc{1} + w) * dt);
+            for (std::size_t i = 0; i < n; ++i) {
+                dU[i] += c_dt * (precision_cast<Acc>(U[i]) - precision_cast<Acc>(history.U_prev[i]));
+            }
+        }
+        solve(U, a0 / dt, dU);
+
+        history.U_prev.assign(U.begin(), U.end());
+        history.dt_prev = dt;
+        for (std::size_t i = 0; i < n; ++i) {
+            U[i] = precision_cast<T>(precision_cast<Acc>(U[i]) + dU[i]);
         }
     }
 };
@@ -92,12 +241,54 @@ struct SSPRK3 {
 // =============================================================================
 
 /// Variant holding all supported time integrators
-using TimeIntegratorVariant = std::variant<ExplicitEuler, SSPRK3>;
+using TimeIntegratorVariant = std::variant<ExplicitEuler, SSPRK3, MUSCLHancock, ADER, BackwardEuler, BDF2>;
 
-/// Advance solution by one timestep
+/**
+ * @brief Advance solution by one timestep with an explicit integrator
+ *
+ * @throws std::invalid_argument for an implicit integrator, which needs the
+ *         overload taking a linear solve
+ */
+template <typename T, typename Acc>
+inline void advance(const TimeIntegratorVariant& integrator, std::span<BasicConservativeVars<T>> U,
+                    Acc dt, const BasicRhsFunction<T, Acc>& rhs) {
+    std::visit([&](const auto& integ) {
+        if constexpr (std::decay_t<decltype(integ)>::is_implicit) {
+            throw std::invalid_argument("Implicit time integrator needs a linear solve");
+        } else {
+            integ.template advance<T, Acc>(U, dt, rhs);
+        }
+    }, integrator);
+}
+
+/// Advance solution by one timestep with any integrator; explicit ones ignore solve and history
+template <typename T, typename Acc>
+inline void advance(const TimeIntegratorVariant& integrator, std::span<BasicConservativeVars<T>> U, Acc dt,
+                    const BasicRhsFunction<T, Acc>& rhs, const BasicLinearSolveFunction<T, Acc>& solve,
+                    BasicStepHistory<T, Acc>& history) {
+    std::visit([&](const auto& integ) {
+        if constexpr (std::decay_t<decltype(integ)>::is_implicit) {
+            integ.template advance<T, Acc>(U, dt, rhs, solve, history);
+        } else {
+            integ.template advance<T, Acc>(U, dt, rhs);
+        }
+    }, integrator);
+}
+
+/// Advance solution by one timestep (default precision)
 inline void advance(const TimeIntegratorVariant& integrator, std::span<ConservativeVars> U,
-                   Real dt, const RhsFunction& rhs) {
-    std::visit([&](const auto& integ) { integ.advance(U, dt, rhs); }, integrator);
+                    Real dt, const RhsFunction& rhs) {
+    advance<Real, Real>(integrator, U, dt, rhs);
+}
+
+/// Number of RHS evaluations per step
+[[nodiscard]] inline int num_stages(const TimeIntegratorVariant& integrator) {
+    return std::visit([](const auto& integ) { return integ.num_stages; }, integrator);
+}
+
+/// Whether the integrator solves a linear system every step
+[[nodiscard]] inline bool is_implicit(const TimeIntegratorVariant& integrator) {
+    return std::visit([](const auto& integ) { return integ.is_implicit; }, integrator);
 }
 
 }  // namespace euler1d
@@ -4,6 +4,10 @@ Validation script for 1D Compressible Euler solver.
 
 Compares numerical results against analytical reference solutions.
 Computes L1, L2, and Linf errors for density, velocity, and pressure.
+
+Numerical solutions are read from the CSV files written by the euler1d
+executable, or with --in-process computed directly through the euler1d
+Python module (built with -DEULER1D_BUILD_PYTHON=ON).
 """
 
 import argparse
@@ -68,6 +72,49 @@ def read_analytical_dat(filepath: Path) -> SolutionData:
     )
 
 
+def solve_in_process(config_path: Path) -> SolutionData:
+    """Run a configuration through the euler1d Python module.
+
+    The arrays are NumPy views of the solver's own memory; only the
+    primitive variables are converted into a new array.
+    """
+    import euler1d
+
+    solver = euler1d.Solver(euler1d.Config(config_path))
+    solver.run()
+    state = np.asarray(solver.state, dtype=np.float64)
+    primitive = np.asarray(solver.primitive(), dtype=np.float64)
+    return SolutionData(
+        x=np.asarray(solver.x),
+        rho=primitive[:, 0],
+        u=primitive[:, 1],
+        p=primitive[:, 2],
+        E=state[:, 2]
+    )
+
+
+def load_numerical(case_num: int,
+                   numerical_dir: Path,
+                   config_dir: Optional[Path]) -> Optional[SolutionData]:
+    """Numerical solution of a test case, or None if it is unavailable.
+
+    With config_dir set the case is solved in-process from its TOML file,
+    otherwise it is read from the CSV file in numerical_dir.
+    """
+    if config_dir is not None:
+        config_file = config_dir / f"test_case{case_num}.toml"
+        if not config_file.exists():
+            print(f"  ERROR: Configuration not found: {config_file}")
+            return None
+        return solve_in_process(config_file)
+
+    numerical_file = numerical_dir / f"test_case{case_num}.csv"
+    if not numerical_file.exists():
+        print(f"  ERROR: Numerical solution not found: {numerical_file}")
+        return None
+    return read_numerical_csv(numerical_file)
+
+
 def interpolate_to_grid(source: SolutionData, target_x: NDArray[np.float64]) -> SolutionData:
     """Interpolate solution to a different grid."""
     return SolutionData(
@@ -91,7 +138,7 @@ def compute_errors(numerical: NDArray[np.float64],
     )
 
 
-def validate_case(numerical_path: Path, 
+def validate_case(num_sol: SolutionData,
                   analytical_path: Path,
                   verbose: bool = True) -> dict:
     """Validate a single test case.
@@ -99,7 +146,6 @@ def validate_case(numerical_path: Path,
     Returns dict with error metrics for each variable.
     """
     # Read data
-    num_sol = read_numerical_csv(numerical_path)
     ana_sol = read_analytical_dat(analytical_path)
     
     # Check if grids match
@@ -132,7 +178,8 @@ def validate_case(numerical_path: Path,
 def run_validation(numerical_dir: Path, 
                    analytical_dir: Path,
                    test_cases: Optional[list[int]] = None,
-                   tolerance: float = 0.1) -> bool:
+                   tolerance: float = 0.1,
+                   config_dir: Optional[Path] = None) -> bool:
     """Run validation for all test cases.
     
     Args:
@@ -140,6 +187,8 @@ def run_validation(numerical_dir: Path,
         analytical_dir: Directory containing analytical DAT files  
         test_cases: List of test case numbers to validate (default: 1-12)
         tolerance: Maximum allowed L1 error for rho (default: 0.1)
+        config_dir: Solve the TOML files in this directory in-process
+            instead of reading CSV files (default: None)
         
     Returns:
         True if all validations pass, False otherwise
@@ -155,7 +204,6 @@ def run_validation(numerical_dir: Path,
     print("=" * 70)
     
     for case_num in test_cases:
-        numerical_file = numerical_dir / f"test_case{case_num}.csv"
         analytical_file = analytical_dir / f"analytical_ref_test_case{case_num}.dat"
         
         print(f"\n{'='*70}")
@@ -163,18 +211,17 @@ def run_validation(numerical_dir: Path,
         print(f"{'='*70}")
         
         # Check files exist
-        if not numerical_file.exists():
-            print(f"  ERROR: Numerical solution not found: {numerical_file}")
-            all_passed = False
-            continue
-            
         if not analytical_file.exists():
             print(f"  ERROR: Analytical reference not found: {analytical_file}")
             all_passed = False
             continue
         
         try:
-            errors = validate_case(numerical_file, analytical_file)
+            num_sol = load_numerical(case_num, numerical_dir, config_dir)
+            if num_sol is None:
+                all_passed = False
+                continue
+            errors = validate_case(num_sol, analytical_file)
             results[case_num] = errors
             
             # Check if errors are within tolerance
@@ -206,7 +253,8 @@ def run_validation(numerical_dir: Path,
 def generate_comparison_plots(numerical_dir: Path,
                                analytical_dir: Path, 
                                output_dir: Path,
-                               test_cases: Optional[list[int]] = None):
+                               test_cases: Optional[list[int]] = None,
+                               config_dir: Optional[Path] = None):
     """Generate comparison plots for each test case."""
     try:
         import matplotlib.pyplot as plt
@@ -220,13 +268,14 @@ def generate_comparison_plots(numerical_dir: Path,
     output_dir.mkdir(parents=True, exist_ok=True)
     
     for case_num in test_cases:
-        numerical_file = numerical_dir / f"test_case{case_num}.csv"
         analytical_file = analytical_dir / f"analytical_ref_test_case{case_num}.dat"
         
-        if not numerical_file.exists() or not analytical_file.exists():
+        if not analytical_file.exists():
             continue
         
-        num_sol = read_numerical_csv(numerical_file)
+        num_sol = load_numerical(case_num, numerical_dir, config_dir)
+        if num_sol is None:
+            continue
         ana_sol = read_analytical_dat(analytical_file)
         
         fig, axes = plt.subplots(2, 2, figsize=(12, 10))
@@ -290,6 +339,23 @@ def main():
         default=0.1,
         help="L1 error tolerance for pass/fail (default: 0.1)"
     )
+    parser.add_argument(
+        "--in-process",
+        action="store_true",
+        help="Solve the cases through the euler1d Python module instead of reading CSV files"
+    )
+    parser.add_argument(
+        "--config-dir",
+        type=Path,
+        default=Path("data"),
+        help="Directory containing test case TOML files for --in-process (default: data/)"
+    )
+    parser.add_argument(
+        "--build-dir",
+        type=Path,
+        default=Path("build"),
+        help="Directory containing the euler1d Python module (default: build/)"
+    )
     parser.add_argument(
         "--plot", "-p",
         action="store_true",
@@ -311,12 +377,18 @@ def main():
     else:
         test_cases = [int(c.strip()) for c in args.cases.split(',')]
     
+    config_dir = None
+    if args.in_process:
+        sys.path.insert(0, str(args.build_dir.resolve()))
+        config_dir = args.config_dir
+    
     # Run validation
     passed = run_validation(
         args.numerical_dir,
         args.analytical_dir,
         test_cases,
-        args.tolerance
+        args.tolerance,
+        config_dir
     )
     
     # Generate plots if requested
@@ -328,7 +400,8 @@ def main():
             args.numerical_dir,
             args.analytical_dir,
             args.plot_dir,
-            test_cases
+            test_cases,
+            config_dir
         )
     
     sys.exit(0 if passed else 1)
@@ -0,0 +1,158 @@
+/**
+ * @file euler1d_c.cpp
+ * @brief C interface implementation
+ */
+
+#include "euler1d/euler1d_c.h"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+// The state is handed out as a flat array of num_components values per cell
+static_assert(std::is_standard_layout_v<euler1d::BasicConservativeVars<double>> &&
+              sizeof(euler1d::BasicConservativeVars<double>) == euler1d::num_components * sizeof(double));
+static_assert(std::is_standard_layout_v<euler1d::BasicConservativeVars<float>> &&
+              sizeof(euler1d::BasicConservativeVars<float>) == euler1d::num_components * sizeof(float));
+
+/// Solver in the precision mode selected by the configuration
+struct euler1d_solver {
+    std::variant<euler1d::BasicSolver<double>, euler1d::BasicSolver<float>,
+                 euler1d::BasicSolver<float, double>> solver;
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+/// Call f(), translating exceptions into a status code and last_error
+template <typename F>
+int guarded(F&& f) noexcept {
+    try {
+        f();
+        return EULER1D_OK;
+    } catch (const std::exception& e) {
+        last_error = e.what();
+    } catch (...) {
+        last_error = "Unknown error";
+    }
+    return EULER1D_ERROR;
+}
+
+/// Apply f to the solver held by the handle
+template <typename Handle, typename F>
+decltype(auto) visit_solver(Handle* handle, F&& f) {
+    return std::visit(std::forward<F>(f), handle->solver);
+}
+
+/// Interior state of the handle as a flat array of T, or nullptr if stored in another precision
+template <typename T>
+T* flat_state(euler1d_solver* handle) noexcept {
+    return visit_solver(handle, [](auto& solver) -> T* {
+        using Conservative = typename std::remove_reference_t<decltype(solver)>::Conservative;
+        if constexpr (std::is_same_v<typename Conservative::value_type, T>) {
+            return &solver.interior().front().rho;
+        } else {
+            return nullptr;
+        }
+    });
+}
+
+}  // namespace
+
+extern "C" {
+
+euler1d_solver* euler1d_create(const char* config_path) {
+    euler1d_solver* handle = nullptr;
+    guarded([&] {
+        const auto config = euler1d::parse_config(config_path);
+        switch (config.execution.precision) {
+            case euler1d::Precision::Double:
+                handle = new euler1d_solver{decltype(euler1d_solver::solver){
+                    std::in_place_type<euler1d::BasicSolver<double>>, config}};
+                break;
+            case euler1d::Precision::Float:
+                handle = new euler1d_solver{decltype(euler1d_solver::solver){
+                    std::in_place_type<euler1d::BasicSolver<float>>, config}};
+                break;
+            case euler1d::Precision::Mixed:
+                handle = new euler1d_solver{decltype(euler1d_solver::solver){
+                    std::in_place_type<euler1d::BasicSolver<float, double>>, config}};
+                break;
+        }
+    });
+    return handle;
+}
+
+void euler1d_destroy(euler1d_solver* solver) {
+    delete solver;
+}
+
+const char* euler1d_last_error(void) {
+    return last_error.c_str();
+}
+
+int euler1d_step(euler1d_solver* solver, double dt) {
+    return guarded([&] {
+        visit_solver(solver, [dt](auto& s) { s.step(static_cast<euler1d::Real>(dt)); });
+    });
+}
+
+int euler1d_advance_to(euler1d_solver* solver, double t) {
+    return guarded([&] {
+        visit_solver(solver, [t](auto& s) { s.advance_to(static_cast<euler1d::Real>(t)); });
+    });
+}
+
+int euler1d_run(euler1d_solver* solver) {
+    return guarded([&] {
+        visit_solver(solver, [](auto& s) { s.run(); });
+    });
+}
+
+int euler1d_compute_dt(const euler1d_solver* solver, double* dt) {
+    return guarded([&] {
+        *dt = static_cast<double>(visit_solver(solver, [](const auto& s) { return s.compute_dt(); }));
+    });
+}
+
+double euler1d_time(const euler1d_solver* solver) {
+    return static_cast<double>(visit_solver(solver, [](const auto& s) { return s.time(); }));
+}
+
+int euler1d_steps(const euler1d_solver* solver) {
+    return visit_solver(solver, [](const auto& s) { return s.steps(); });
+}
+
+int euler1d_num_cells(const euler1d_solver* solver) {
+    return visit_solver(solver, [](const auto& s) { return s.mesh().num_cells(); });
+}
+
+int euler1d_num_components(void) {
+    return static_cast<int>(euler1d::num_components);
+}
+
+void euler1d_cell_centers(const euler1d_solver* solver, double* x) {
+    visit_solver(solver, [x](const auto& s) {
+        const auto& mesh = s.mesh();
+        for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
+            x[i - mesh.first_interior()] = static_cast<double>(mesh.x(i));
+        }
+    });
+}
+
+double* euler1d_state_f64(euler1d_solver* solver) {
+    return flat_state<double>(solver);
+}
+
+float* euler1d_state_f32(euler1d_solver* solver) {
+    return flat_state<float>(solver);
+}
+
+void euler1d_set_verbose(euler1d_solver* solver, int verbose) {
+    visit_solver(solver, [verbose](auto& s) { s.set_verbose(verbose != 0); });
+}
+
+}  // extern "C"
@@ -7,6 +7,7 @@
 #include <toml++/toml.hpp>
 #include <algorithm>
 #include <cctype>
+#include <string>
 
 namespace euler1d {
 
@@ -32,6 +33,13 @@ FluxScheme parse_flux_scheme(const std::string& str) {
     if (lower == "hll") return FluxScheme::HLL;
     if (lower == "hllc") return FluxScheme::HLLC;
     if (lower == "movers_le") return FluxScheme::MoversLE;
+    if (lower == "steger_warming") return FluxScheme::StegerWarming;
+    if (lower == "van_leer" || lower == "vanleer") return FluxScheme::VanLeer;
+    if (lower == "ausm_plus" || lower == "ausm+") return FluxScheme::AUSMPlus;
+    if (lower == "ausm_plus_up" || lower == "ausm+-up" || lower == "ausm+up") return FluxScheme::AUSMPlusUp;
+    if (lower == "roe") return FluxScheme::Roe;
+    if (lower == "hlle" || lower == "hll_einfeldt") return FluxScheme::HLLE;
+    if (lower == "kurganov_tadmor" || lower == "kt" || lower == "central_upwind") return FluxScheme::KurganovTadmor;
     throw ConfigError("Unknown flux scheme: " + str);
 }
 
@@ -45,6 +53,13 @@ Limiter parse_limiter(const std::string& str) {
     throw ConfigError("Unknown limiter: " + str);
 }
 
+Slopes parse_slopes(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "cell" || lower == "per_cell") return Slopes::Cell;
+    if (lower == "face" || lower == "per_face") return Slopes::Face;
+    throw ConfigError("Unknown slope evaluation: " + str);
+}
+
 TimeIntegrator parse_time_integrator(const std::string& str) {
     const auto lower = to_lower(str);
     if (lower == "euler" || lower == "explicit_euler" || lower == "forward_euler") {
@@ -53,9 +68,22 @@ TimeIntegrator parse_time_integrator(const std::string& str) {
     if (lower == "ssprk3" || lower == "rk3" || lower == "ssp_rk3") {
         return TimeIntegrator::SSPRK3;
     }
+    if (lower == "muscl_hancock" || lower == "hancock") return TimeIntegrator::MUSCLHancock;
+    if (lower == "ader" || lower == "ader3") return TimeIntegrator::ADER;
+    if (lower == "backward_euler" || lower == "implicit_euler" || lower == "bdf1") {
+        return TimeIntegrator::BackwardEuler;
+    }
+    if (lower == "bdf2") return TimeIntegrator::BDF2;
     throw ConfigError("Unknown time integrator: " + str);
 }
 
+LinearSolver parse_linear_solver(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "thomas" || lower == "block_thomas") return LinearSolver::Thomas;
+    if (lower == "pcr" || lower == "parallel_cyclic_reduction") return LinearSolver::PCR;
+    throw ConfigError("Unknown linear solver: " + str);
+}
+
 BoundaryType parse_boundary_type(const std::string& str) {
     const auto lower = to_lower(str);
     if (lower == "transmissive" || lower == "outflow" || lower == "zero_gradient") {
@@ -74,6 +102,22 @@ EosModel parse_eos_model(const std::string& str) {
     throw ConfigError("Unknown EOS model: " + str);
 }
 
+Precision parse_precision(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "double" || lower == "fp64") return Precision::Double;
+    if (lower == "float" || lower == "single" || lower == "fp32") return Precision::Float;
+    if (lower == "mixed") return Precision::Mixed;
+    throw ConfigError("Unknown precision: " + str);
+}
+
+HugePages parse_huge_pages(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "none" || lower == "off") return HugePages::None;
+    if (lower == "transparent" || lower == "thp" || lower == "madvise") return HugePages::Transparent;
+    if (lower == "explicit" || lower == "hugetlb" || lower == "2mb") return HugePages::Explicit;
+    throw ConfigError("Unknown huge pages policy: " + str);
+}
+
 InitialConditionType parse_initial_condition_type(const std::string& str) {
     const auto lower = to_lower(str);
     if (lower == "piecewise_constant" || lower == "piecewiseconstant") {
@@ -86,6 +130,22 @@ InitialConditionType parse_initial_condition_type(const std::string& str) {
     throw ConfigError("Unknown initial condition type: " + str);
 }
 
+SourceType parse_source_type(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "none") return SourceType::None;
+    if (lower == "geometric" || lower == "area" || lower == "nozzle") return SourceType::Geometric;
+    if (lower == "gravity") return SourceType::Gravity;
+    if (lower == "reaction" || lower == "arrhenius") return SourceType::Reaction;
+    throw ConfigError("Unknown source type: " + str);
+}
+
+SourceCoupling parse_source_coupling(const std::string& str) {
+    const auto lower = to_lower(str);
+    if (lower == "explicit" || lower == "unsplit") return SourceCoupling::Explicit;
+    if (lower == "strang" || lower == "split") return SourceCoupling::Strang;
+    throw ConfigError("Unknown source coupling: " + str);
+}
+
 // =============================================================================
 // Main parser
 // =============================================================================
@@ -121,6 +181,9 @@ Config parse_config(const std::filesystem::path& path) {
         if (auto v = (*mesh)["num_cells"].value<int64_t>()) {
             config.mesh.num_cells = static_cast<int>(*v);
         }
+        if (auto v = (*mesh)["expand"].value<bool>()) {
+            config.mesh.expand = *v;
+        }
     }
 
     // [time]
@@ -134,6 +197,15 @@ Config parse_config(const std::filesystem::path& path) {
         if (auto v = (*time)["time_integrator"].value<std::string>()) {
             config.time.integrator = parse_time_integrator(*v);
         }
+        if (auto v = (*time)["max_retries"].value<int64_t>()) {
+            if (*v < 0) {
+                throw ConfigError("time.max_retries must be non-negative");
+            }
+            config.time.max_retries = static_cast<int>(*v);
+        }
+        if (auto v = (*time)["linear_solver"].value<std::string>()) {
+            config.time.linear_solver = parse_linear_solver(*v);
+        }
     }
 
     // [numerics]
@@ -147,6 +219,61 @@ Config parse_config(const std::filesystem::path& path) {
         if (auto v = (*num)["limiter"].value<std::string>()) {
             config.numerics.limiter = parse_limiter(*v);
         }
+        if (auto v = (*num)["slopes"].value<std::string>()) {
+            config.numerics.slopes = parse_slopes(*v);
+        }
+        if (auto v = (*num)["positivity"].value<bool>()) {
+            config.numerics.positivity = *v;
+        }
+        if (auto v = (*num)["hybrid_flux"].value<bool>()) {
+            config.numerics.hybrid_flux = *v;
+        }
+        if (auto v = (*num)["sensor_threshold"].value<double>()) {
+            if (!(*v > 0.0)) {
+                throw ConfigError("numerics.sensor_threshold must be positive");
+            }
+            config.numerics.sensor_threshold = static_cast<Real>(*v);
+        }
+    }
+
+    // [execution]
+    if (auto exec = tbl["execution"].as_table()) {
+        if (auto v = (*exec)["tile_cells"].value<int64_t>()) {
+            if (*v < 0) {
+                throw ConfigError("execution.tile_cells must be non-negative");
+            }
+            config.execution.tile_cells = static_cast<int>(*v);
+        }
+        if (auto v = (*exec)["threads"].value<int64_t>()) {
+            if (*v < 0) {
+                throw ConfigError("execution.threads must be non-negative");
+            }
+            config.execution.threads = static_cast<int>(*v);
+        }
+        if (auto v = (*exec)["processes"].value<int64_t>()) {
+            if (*v < 1) {
+                throw ConfigError("execution.processes must be at least 1");
+            }
+            config.execution.processes = static_cast<int>(*v);
+        }
+        if (auto v = (*exec)["rank_output"].value<bool>()) {
+            config.execution.rank_output = *v;
+        }
+        if (config.execution.processes > 1 && config.execution.threads > 1) {
+            throw ConfigError("execution.threads and execution.processes cannot both exceed 1");
+        }
+        if (auto v = (*exec)["precision"].value<std::string>()) {
+            config.execution.precision = parse_precision(*v);
+        }
+        if (auto v = (*exec)["huge_pages"].value<std::string>()) {
+            config.execution.huge_pages = parse_huge_pages(*v);
+        }
+        if (auto v = (*exec)["first_touch"].value<bool>()) {
+            config.execution.first_touch = *v;
+        }
+        if (auto v = (*exec)["active_regions"].value<bool>()) {
+            config.execution.active_regions = *v;
+        }
     }
 
     // [eos]
@@ -197,6 +324,21 @@ Config parse_config(const std::filesystem::path& path) {
                         if (auto v = (*reg)["p"].value<double>()) {
                             region.p = static_cast<Real>(*v);
                         }
+                        if (auto scalars = (*reg)["scalars"].as_array()) {
+                            for (const auto& value : *scalars) {
+                                if (auto v = value.value<double>()) {
+                                    region.scalars.push_back(static_cast<Real>(*v));
+                                } else {
+                                    throw ConfigError("initial_condition.region.scalars must contain numbers");
+                                }
+                            }
+                            if (region.scalars.size() != num_scalars) {
+                                throw ConfigError("initial_condition.region.scalars has " +
+                                                  std::to_string(region.scalars.size()) +
+                                                  " entries, but the solver was built with EULER1D_NUM_SCALARS=" +
+                                                  std::to_string(num_scalars));
+                            }
+                        }
                         config.initial_condition.regions.push_back(region);
                     }
                 }
@@ -245,7 +387,137 @@ Config parse_config(const std::filesystem::path& path) {
         }
     }
 
+    // [source]
+    if (auto src = tbl["source"].as_table()) {
+        if (auto v = (*src)["type"].value<std::string>()) {
+            config.source.type = parse_source_type(*v);
+        }
+        if (auto v = (*src)["coupling"].value<std::string>()) {
+            config.source.coupling = parse_source_coupling(*v);
+        }
+        const auto symmetry = (*src)["symmetry"].value<std::string>();
+        if (symmetry) {
+            // Shorthand for the area of a radial coordinate x = r
+            const auto lower = to_lower(*symmetry);
+            if (lower == "planar") {
+                config.source.area = {1.0};
+            } else if (lower == "cylindrical") {
+                config.source.area = {0.0, 1.0};
+            } else if (lower == "spherical") {
+                config.source.area = {0.0, 0.0, 1.0};
+            } else {
+                throw ConfigError("Unknown source symmetry: " + *symmetry);
+            }
+        }
+        if (auto area = (*src)["area"].as_array()) {
+            if (symmetry) {
+                throw ConfigError("source.area and source.symmetry cannot both be given");
+            }
+            config.source.area.clear();
+            for (const auto& value : *area) {
+                if (auto v = value.value<double>()) {
+                    config.source.area.push_back(static_cast<Real>(*v));
+                } else {
+                    throw ConfigError("source.area must contain numbers");
+                }
+            }
+            if (config.source.area.empty()) {
+                throw ConfigError("source.area must have at least one coefficient");
+            }
+        }
+        if (auto v = (*src)["gravity"].value<double>()) {
+            config.source.gravity = static_cast<Real>(*v);
+        }
+        if (auto v = (*src)["rate_constant"].value<double>()) {
+            if (*v < 0) {
+                throw ConfigError("source.rate_constant must be non-negative");
+            }
+            config.source.rate_constant = static_cast<Real>(*v);
+        }
+        if (auto v = (*src)["activation_temperature"].value<double>()) {
+            if (*v < 0) {
+                throw ConfigError("source.activation_temperature must be non-negative");
+            }
+            config.source.activation_temperature = static_cast<Real>(*v);
+        }
+        if (auto v = (*src)["heat_release"].value<double>()) {
+            config.source.heat_release = static_cast<Real>(*v);
+        }
+        if (config.source.type == SourceType::Reaction && num_scalars == 0) {
+            throw ConfigError("source.type = \"reaction\" consumes passive scalar 0, "
+                              "but the solver was built with EULER1D_NUM_SCALARS=0");
+        }
+    }
+
+    // [steady]
+    if (auto steady = tbl["steady"].as_table()) {
+        if (auto v = (*steady)["enabled"].value<bool>()) {
+            config.steady.enabled = *v;
+        }
+        if (auto v = (*steady)["tolerance"].value<double>()) {
+            if (!(*v > 0)) {
+                throw ConfigError("steady.tolerance must be positive");
+            }
+            config.steady.tolerance = static_cast<Real>(*v);
+        }
+        if (auto v = (*steady)["max_iterations"].value<int64_t>()) {
+            if (*v < 1) {
+                throw ConfigError("steady.max_iterations must be at least 1");
+            }
+            config.steady.max_iterations = static_cast<int>(*v);
+        }
+        if (auto v = (*steady)["local_time_stepping"].value<bool>()) {
+            config.steady.local_time_stepping = *v;
+        }
+        if (auto v = (*steady)["multigrid_levels"].value<int64_t>()) {
+            if (*v < 1) {
+                throw ConfigError("steady.multigrid_levels must be at least 1");
+            }
+            config.steady.multigrid_levels = static_cast<int>(*v);
+        }
+        if (config.steady.enabled && config.source.coupling == SourceCoupling::Strang) {
+            throw ConfigError("steady mode needs source.coupling = \"explicit\": "
+                              "a split source step has no steady residual");
+        }
+        const bool implicit = config.time.integrator == TimeIntegrator::BackwardEuler ||
+                              config.time.integrator == TimeIntegrator::BDF2;
+        if (config.steady.local_time_stepping && implicit) {
+            throw ConfigError("steady.local_time_stepping requires an explicit time integrator");
+        }
+        const bool predictor = config.time.integrator == TimeIntegrator::MUSCLHancock ||
+                               config.time.integrator == TimeIntegrator::ADER;
+        if (config.steady.local_time_stepping && predictor) {
+            throw ConfigError("steady.local_time_stepping is not supported by muscl_hancock and ader: "
+                              "their predictor is sized for one global step");
+        }
+    }
+
+    validate_expand(config);
+
     return config;
 }
 
+void validate_expand(const Config& config) {
+    // The window grows into uniform far field
+    if (!config.mesh.expand) {
+        return;
+    }
+    if (config.initial_condition.type != InitialConditionType::PiecewiseConstant) {
+        throw ConfigError("mesh.expand needs a piecewise_constant initial condition");
+    }
+    if (config.boundary.left != BoundaryType::Transmissive ||
+        config.boundary.right != BoundaryType::Transmissive) {
+        throw ConfigError("mesh.expand needs transmissive boundaries: the window edges are open far field");
+    }
+    if (config.source.type != SourceType::None) {
+        throw ConfigError("mesh.expand does not support sources: the far field would not stay uniform");
+    }
+    if (config.time.integrator == TimeIntegrator::BackwardEuler || config.time.integrator == TimeIntegrator::BDF2) {
+        throw ConfigError("mesh.expand requires an explicit time integrator");
+    }
+    if (config.execution.threads != 1 || config.execution.processes != 1 || config.steady.enabled) {
+        throw ConfigError("mesh.expand runs unsteady on a single rank");
+    }
+}
+
 }  // namespace euler1d
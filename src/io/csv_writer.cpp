@@ -10,8 +10,9 @@
 
 namespace euler1d {
 
+template <typename T>
 void write_csv(const std::filesystem::path& path, const Mesh1D& mesh,
-               const ConservativeArray& U, const PrimitiveArray& W, Real time) {
+               std::span<const BasicConservativeVars<T>> U, const BasicPrimitiveArray<T>& W, Real time) {
     std::ofstream file(path);
     if (!file) {
         throw std::runtime_error("Cannot open file for writing: " + path.string());
@@ -22,7 +23,11 @@ void write_csv(const std::filesystem::path& path, const Mesh1D& mesh,
 
     // Header
     file << "# 1D Euler solution at time = " << time << "\n";
-    file << "# x,rho,u,p,E\n";
+    file << "# x,rho,u,p,E";
+    for (std::size_t k = 0; k < num_scalars; ++k) {
+        file << ",phi" << k + 1;
+    }
+    file << "\n";
 
     // Write interior cells only
     for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
@@ -31,8 +36,15 @@ void write_csv(const std::filesystem::path& path, const Mesh1D& mesh,
              << W[idx].rho << ","
              << W[idx].u << ","
              << W[idx].p << ","
-             << U[idx].E << "\n";
+             << U[idx].E;
+        W[idx].for_each_scalar([&](auto k) { file << "," << W[idx].phi[k]; });
+        file << "\n";
     }
 }
 
+template void write_csv<float>(const std::filesystem::path&, const Mesh1D&,
+                               std::span<const BasicConservativeVars<float>>, const BasicPrimitiveArray<float>&, Real);
+template void write_csv<double>(const std::filesystem::path&, const Mesh1D&,
+                                std::span<const BasicConservativeVars<double>>, const BasicPrimitiveArray<double>&, Real);
+
 }  // namespace euler1d
@@ -10,8 +10,9 @@
 
 namespace euler1d {
 
+template <typename T>
 void write_vtk(const std::filesystem::path& path, const Mesh1D& mesh,
-               const ConservativeArray& U, const PrimitiveArray& W, Real /*time*/) {
+               std::span<const BasicConservativeVars<T>> U, const BasicPrimitiveArray<T>& W, Real /*time*/) {
     std::ofstream file(path);
     if (!file) {
         throw std::runtime_error("Cannot open file for writing: " + path.string());
@@ -65,6 +66,20 @@ void write_vtk(const std::filesystem::path& path, const Mesh1D& mesh,
     for (int i = 0; i < n; ++i) {
         file << U[static_cast<std::size_t>(first + i)].E << "\n";
     }
+
+    // Passive scalars
+    BasicPrimitiveVars<T>::for_each_scalar([&](auto k) {
+        file << "\nSCALARS phi" << k + 1 << " double 1\n";
+        file << "LOOKUP_TABLE default\n";
+        for (int i = 0; i < n; ++i) {
+            file << W[static_cast<std::size_t>(first + i)].phi[k] << "\n";
+        }
+    });
 }
 
+template void write_vtk<float>(const std::filesystem::path&, const Mesh1D&,
+                               std::span<const BasicConservativeVars<float>>, const BasicPrimitiveArray<float>&, Real);
+template void write_vtk<double>(const std::filesystem::path&, const Mesh1D&,
+                                std::span<const BasicConservativeVars<double>>, const BasicPrimitiveArray<double>&, Real);
+
 }  // namespace euler1d
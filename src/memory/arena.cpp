@@ -0,0 +1,222 @@
+/**
+ * @file arena.cpp
+ * @brief Arena reservation and bump allocation
+ */
+
+#include "euler1d/memory/arena.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define EULER1D_HAVE_MMAP 1
+#endif
+
+namespace euler1d {
+
+namespace {
+
+/// Size and alignment of a transparent huge page on x86-64 and most ARM kernels
+constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+/// Granularity at which the kernel faults in base pages
+constexpr std::size_t base_page_size = 4096;
+
+thread_local Arena* current_arena = nullptr;
+
+constexpr std::size_t round_up(std::size_t bytes, std::size_t multiple) noexcept {
+    return (bytes + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+Arena::Arena(std::size_t capacity, HugePages pages) : capacity_{round_up(capacity, huge_page_size)} {
+    if (capacity_ == 0) {
+        return;
+    }
+#ifdef EULER1D_HAVE_MMAP
+#ifdef MAP_HUGETLB
+    if (pages == HugePages::Explicit) {
+        // Reserved from the pool up front (no MAP_NORESERVE): a pool that is too
+        // small fails here instead of raising SIGBUS on first touch
+        mapping_ = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapping_ != MAP_FAILED) {
+            mapping_size_ = capacity_;
+            base_ = static_cast<std::byte*>(mapping_);
+            pages_ = HugePages::Explicit;
+            return;
+        }
+        mapping_ = nullptr;
+    }
+#endif
+    // Over-reserve by one huge page so the usable block can start on a boundary
+    mapping_size_ = capacity_ + huge_page_size;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error("mmap of a " + std::to_string(capacity_) + "-byte arena failed");
+    }
+    const auto address = reinterpret_cast<std::uintptr_t>(mapping_);
+    base_ = static_cast<std::byte*>(mapping_) + (round_up(address, huge_page_size) - address);
+#ifdef MADV_HUGEPAGE
+    // Advisory; the arena works without huge pages
+    if (pages != HugePages::None && madvise(base_, capacity_, MADV_HUGEPAGE) == 0) {
+        pages_ = HugePages::Transparent;
+    }
+#endif
+#else
+    static_cast<void>(pages);
+    mapping_ = ::operator new(capacity_, std::align_val_t{huge_page_size});
+    mapping_size_ = capacity_;
+    base_ = static_cast<std::byte*>(mapping_);
+#endif
+}
+
+Arena::~Arena() {
+    if (mapping_ == nullptr) {
+        return;
+    }
+#ifdef EULER1D_HAVE_MMAP
+    munmap(mapping_, mapping_size_);
+#else
+    ::operator delete(mapping_, std::align_val_t{huge_page_size});
+#endif
+}
+
+void* Arena::allocate(std::size_t bytes) {
+    const std::size_t size = round_up(std::max<std::size_t>(bytes, 1), alignment);
+    void* p = nullptr;
+    if (size <= capacity_ - offset_) {
+        p = base_ + offset_;
+        if (touch_threads_ > 1 && offset_ + size > touched_) {
+            first_touch(std::max(offset_, touched_), offset_ + size);
+        }
+        offset_ += size;
+        peak_ = std::max(peak_, offset_);
+        touched_ = std::max(touched_, offset_);
+    } else {
+        p = ::operator new(size, std::align_val_t{alignment});
+        overflow_bytes_ += size;
+    }
+    ++live_;
+    ++allocations_;
+    return p;
+}
+
+void Arena::deallocate(void* p, std::size_t bytes) noexcept {
+    if (p == nullptr) {
+        return;
+    }
+    --live_;
+    if (!owns(p)) {
+        ::operator delete(p, std::align_val_t{alignment});
+        return;
+    }
+    auto* block = static_cast<std::byte*>(p);
+    if (block + round_up(std::max<std::size_t>(bytes, 1), alignment) == base_ + offset_) {
+        offset_ = static_cast<std::size_t>(block - base_);
+    }
+}
+
+void Arena::reset() {
+    if (live_ != 0) {
+        throw std::logic_error("Arena reset with " + std::to_string(live_) + " live allocations");
+    }
+    offset_ = 0;
+}
+
+auto Arena::stats() const noexcept -> Stats {
+    return {capacity_, offset_, peak_, live_, allocations_, overflow_bytes_, pages_};
+}
+
+auto Arena::page_usage() const -> PageUsage {
+    PageUsage usage;
+#ifdef __linux__
+    if (base_ == nullptr) {
+        return usage;
+    }
+    const auto first = reinterpret_cast<std::uintptr_t>(base_);
+    const auto last = first + capacity_;
+
+    // Each mapping starts with "start-end perms ...", followed by "Key: value kB" lines
+    std::ifstream smaps("/proc/self/smaps");
+    bool overlaps = false;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        std::uintptr_t start = 0;
+        std::uintptr_t end = 0;
+        if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR, &start, &end) == 2) {
+            overlaps = start < last && end > first;
+            continue;
+        }
+        const auto colon = line.find(':');
+        if (!overlaps || colon == std::string::npos) {
+            continue;
+        }
+        const std::string key = line.substr(0, colon);
+        const bool hugetlb = key == "Private_Hugetlb" || key == "Shared_Hugetlb";
+        if (key != "Rss" && key != "AnonHugePages" && !hugetlb) {
+            continue;
+        }
+        const std::size_t bytes = std::stoull(line.substr(colon + 1)) * 1024;
+        // Pages of hugetlbfs are not counted in Rss
+        if (key == "Rss" || hugetlb) {
+            usage.resident_bytes += bytes;
+        }
+        if (key == "AnonHugePages" || hugetlb) {
+            usage.huge_page_bytes += bytes;
+        }
+    }
+#endif
+    return usage;
+}
+
+Arena* Arena::current() noexcept {
+    return current_arena;
+}
+
+void Arena::first_touch(std::size_t begin, std::size_t end) {
+    const auto threads = static_cast<std::size_t>(touch_threads_);
+    if (end - begin < threads * huge_page_size) {
+        return;  // Not worth the threads
+    }
+    // Slices end on page boundaries, so no page is faulted in by two threads
+    const std::size_t page = pages_ == HugePages::None ? base_page_size : huge_page_size;
+    auto slice_begin = [&](std::size_t k) {
+        return k == threads ? end : std::min(end, round_up(begin + (end - begin) * k / threads, page));
+    };
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t k = 0; k < threads; ++k) {
+        workers.emplace_back([this, from = slice_begin(k), to = slice_begin(k + 1)] {
+            for (std::size_t offset = from; offset < to; offset += base_page_size) {
+                base_[offset] = std::byte{0};
+            }
+        });
+    }
+}
+
+bool Arena::owns(const void* p) const noexcept {
+    const auto* block = static_cast<const std::byte*>(p);
+    return base_ != nullptr && block >= base_ && block < base_ + capacity_;
+}
+
+ArenaScope::ArenaScope(Arena* arena) noexcept : previous_{current_arena} {
+    current_arena = arena;
+}
+
+ArenaScope::~ArenaScope() {
+    current_arena = previous_;
+}
+
+}  // namespace euler1d
@@ -0,0 +1,25 @@
+/**
+ * @file mesh_hierarchy.cpp
+ * @brief Mesh hierarchy implementation
+ */
+
+#include "euler1d/mesh/mesh_hierarchy.hpp"
+#include <stdexcept>
+
+namespace euler1d {
+
+MeshHierarchy::MeshHierarchy(const Mesh1D& finest, int max_levels, int min_cells) {
+    if (max_levels < 1) {
+        throw std::invalid_argument("max_levels must be at least 1");
+    }
+    levels_.push_back(finest);
+    while (num_levels() < max_levels) {
+        const int n = levels_.back().num_cells();
+        if (n % 2 != 0 || n / 2 < min_cells) {
+            break;
+        }
+        levels_.emplace_back(finest.xmin(), finest.xmax(), n / 2);
+    }
+}
+
+}  // namespace euler1d
@@ -0,0 +1,183 @@
+/**
+ * @file ranks.cpp
+ * @brief Thread and process rank launchers, shared memory mapping
+ */
+
+#include "euler1d/parallel/communicator.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define EULER1D_HAVE_FORK 1
+#endif
+
+namespace euler1d {
+
+namespace {
+
+/// Whether error holds a RankAborted, i.e. is a consequence of another rank's failure
+bool is_rank_aborted(const std::exception_ptr& error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const RankAborted&) {
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+}  // namespace
+
+void run_thread_ranks(int num_ranks, const std::function<void(int)>& body, const std::function<void()>& abort) {
+    std::vector<std::exception_ptr> errors(static_cast<std::size_t>(num_ranks));
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(static_cast<std::size_t>(num_ranks));
+        for (int rank = 0; rank < num_ranks; ++rank) {
+            workers.emplace_back([&body, &abort, &errors, rank] {
+                try {
+                    body(rank);
+                } catch (...) {
+                    errors[static_cast<std::size_t>(rank)] = std::current_exception();
+                    if (abort) {
+                        abort();
+                    }
+                }
+            });
+        }
+    }  // jthreads join here
+
+    // The cause rather than the ranks that gave up waiting for it
+    std::exception_ptr aborted;
+    for (const auto& error : errors) {
+        if (error && !is_rank_aborted(error)) {
+            std::rethrow_exception(error);
+        }
+        if (error && !aborted) {
+            aborted = error;
+        }
+    }
+    if (aborted) {
+        std::rethrow_exception(aborted);
+    }
+}
+
+#ifdef EULER1D_HAVE_FORK
+
+void run_process_ranks(int num_ranks, const std::function<void(int)>& body, const std::function<void()>& abort) {
+    // Children inherit unflushed stdio buffers and would print them twice
+    std::fflush(nullptr);
+
+    std::vector<pid_t> children;
+    for (int rank = 1; rank < num_ranks; ++rank) {
+        const pid_t pid = fork();
+        if (pid < 0) {
+            // The children forked so far wait for rank 0, which will not run
+            for (const pid_t child : children) {
+                kill(child, SIGKILL);
+                waitpid(child, nullptr, 0);
+            }
+            throw std::runtime_error("fork failed for rank " + std::to_string(rank));
+        }
+        if (pid == 0) {
+            int status = EXIT_SUCCESS;
+            try {
+                body(rank);
+            } catch (...) {
+                status = EXIT_FAILURE;
+                if (abort) {
+                    abort();
+                }
+            }
+            std::fflush(nullptr);
+            _exit(status);  // Skip atexit handlers and destructors owned by the parent
+        }
+        children.push_back(pid);
+    }
+
+    // A child that dies without throwing (a signal, _exit from a library)
+    // cannot raise the abort flag itself, so the parent polls for it
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    {
+        std::jthread reaper([&children, &failed, &abort] {
+            std::vector<pid_t> running = children;
+            while (!running.empty()) {
+                std::erase_if(running, [&](pid_t pid) {
+                    int status = 0;
+                    const pid_t result = waitpid(pid, &status, WNOHANG);
+                    if (result == 0) {
+                        return false;
+                    }
+                    if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+                        failed.store(true);
+                        if (abort) {
+                            abort();
+                        }
+                    }
+                    return true;
+                });
+                if (!running.empty()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        });
+
+        try {
+            body(0);
+        } catch (...) {
+            error = std::current_exception();
+            if (abort) {
+                abort();
+            }
+        }
+    }  // The reaper joins once every child has exited
+
+    if (error && !(failed.load() && is_rank_aborted(error))) {
+        std::rethrow_exception(error);
+    }
+    if (failed.load()) {
+        throw std::runtime_error("A subdomain process exited abnormally");
+    }
+}
+
+SharedMemoryRegion::SharedMemoryRegion(std::size_t bytes) : size_{bytes} {
+    data_ = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        throw std::runtime_error("mmap of " + std::to_string(bytes) + " shared bytes failed");
+    }
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+#else
+
+void run_process_ranks(int /*num_ranks*/, const std::function<void(int)>& /*body*/) {
+    throw std::runtime_error("Process ranks require fork() and are not available on this platform");
+}
+
+SharedMemoryRegion::SharedMemoryRegion(std::size_t bytes) : size_{bytes} {
+    throw std::runtime_error("Shared memory ranks are not available on this platform");
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() = default;
+
+#endif
+
+}  // namespace euler1d
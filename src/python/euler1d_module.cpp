@@ -0,0 +1,628 @@
+/**
+ * @file euler1d_module.cpp
+ * @brief CPython extension module `euler1d`
+ *
+ * Exposes Config and Solver on top of the stepping API. Solver implements
+ * the buffer protocol over its interior cells, so `numpy.asarray(solver)` or
+ * `solver.state` is a writable (num_cells, num_components) view of
+ * (rho, rho*u, E, rho*phi_k...) with no copy. Only the limited set of C API calls needed for that is used, so no
+ * NumPy headers are required at build time.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+using namespace euler1d;
+
+namespace {
+
+// =============================================================================
+// Error translation
+// =============================================================================
+
+/// Run f() and translate C++ exceptions into Python exceptions; returns false on error
+template <typename F>
+bool guarded(F&& f) {
+    try {
+        f();
+        return true;
+    } catch (const ConfigError& e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+    } catch (const std::invalid_argument& e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+    } catch (const std::bad_alloc&) {
+        PyErr_NoMemory();
+    } catch (const std::exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    }
+    return false;
+}
+
+/// Like guarded(), but with the GIL released while f() runs
+template <typename F>
+bool guarded_nogil(F&& f) {
+    bool ok = false;
+    std::exception_ptr error;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        f();
+        ok = true;
+    } catch (...) {
+        error = std::current_exception();
+    }
+    Py_END_ALLOW_THREADS
+    return ok || guarded([&] { std::rethrow_exception(error); });
+}
+
+// =============================================================================
+// Value conversion for Config attributes
+// =============================================================================
+
+const char* enum_name(FluxScheme v) {
+    switch (v) {
+        case FluxScheme::LLF: return "llf";
+        case FluxScheme::Rusanov: return "rusanov";
+        case FluxScheme::HLL: return "hll";
+        case FluxScheme::HLLC: return "hllc";
+        case FluxScheme::MoversLE: return "movers_le";
+        case FluxScheme::StegerWarming: return "steger_warming";
+        case FluxScheme::VanLeer: return "van_leer";
+        case FluxScheme::AUSMPlus: return "ausm_plus";
+        case FluxScheme::AUSMPlusUp: return "ausm_plus_up";
+        case FluxScheme::Roe: return "roe";
+        case FluxScheme::HLLE: return "hlle";
+        case FluxScheme::KurganovTadmor: return "kurganov_tadmor";
+    }
+    return "";
+}
+
+const char* enum_name(Limiter v) {
+    switch (v) {
+        case Limiter::None: return "none";
+        case Limiter::Minmod: return "minmod";
+        case Limiter::VanLeer: return "vanleer";
+        case Limiter::Superbee: return "superbee";
+        case Limiter::MC: return "mc";
+    }
+    return "";
+}
+
+const char* enum_name(TimeIntegrator v) {
+    switch (v) {
+        case TimeIntegrator::ExplicitEuler: return "euler";
+        case TimeIntegrator::SSPRK3: return "ssprk3";
+        case TimeIntegrator::MUSCLHancock: return "muscl_hancock";
+        case TimeIntegrator::ADER: return "ader";
+        case TimeIntegrator::BackwardEuler: return "backward_euler";
+        case TimeIntegrator::BDF2: return "bdf2";
+    }
+    return "";
+}
+
+const char* enum_name(LinearSolver v) {
+    switch (v) {
+        case LinearSolver::Thomas: return "thomas";
+        case LinearSolver::PCR: return "pcr";
+    }
+    return "";
+}
+
+const char* enum_name(BoundaryType v) {
+    switch (v) {
+        case BoundaryType::Transmissive: return "transmissive";
+        case BoundaryType::Reflective: return "reflective";
+        case BoundaryType::Periodic: return "periodic";
+    }
+    return "";
+}
+
+const char* enum_name(Precision v) {
+    switch (v) {
+        case Precision::Double: return "double";
+        case Precision::Float: return "float";
+        case Precision::Mixed: return "mixed";
+    }
+    return "";
+}
+
+void parse_enum(const std::string& s, FluxScheme& v) { v = parse_flux_scheme(s); }
+void parse_enum(const std::string& s, Limiter& v) { v = parse_limiter(s); }
+void parse_enum(const std::string& s, TimeIntegrator& v) { v = parse_time_integrator(s); }
+void parse_enum(const std::string& s, LinearSolver& v) { v = parse_linear_solver(s); }
+void parse_enum(const std::string& s, BoundaryType& v) { v = parse_boundary_type(s); }
+void parse_enum(const std::string& s, Precision& v) { v = parse_precision(s); }
+
+template <typename V>
+PyObject* to_python(const V& v) {
+    if constexpr (std::is_same_v<V, bool>) {
+        return PyBool_FromLong(v);
+    } else if constexpr (std::is_integral_v<V>) {
+        return PyLong_FromLong(v);
+    } else if constexpr (std::is_floating_point_v<V>) {
+        return PyFloat_FromDouble(static_cast<double>(v));
+    } else if constexpr (std::is_same_v<V, std::string>) {
+        return PyUnicode_FromStringAndSize(v.data(), static_cast<Py_ssize_t>(v.size()));
+    } else {
+        return PyUnicode_FromString(enum_name(v));
+    }
+}
+
+template <typename V>
+bool from_python(PyObject* obj, V& v) {
+    if constexpr (std::is_same_v<V, bool>) {
+        const int truth = PyObject_IsTrue(obj);
+        v = truth > 0;
+        return truth >= 0;
+    } else if constexpr (std::is_integral_v<V>) {
+        const long value = PyLong_AsLong(obj);
+        if (value == -1 && PyErr_Occurred()) {
+            return false;
+        }
+        v = static_cast<V>(value);
+        return true;
+    } else if constexpr (std::is_floating_point_v<V>) {
+        const double value = PyFloat_AsDouble(obj);
+        if (value == -1.0 && PyErr_Occurred()) {
+            return false;
+        }
+        v = static_cast<V>(value);
+        return true;
+    } else {
+        const char* s = PyUnicode_AsUTF8(obj);
+        if (s == nullptr) {
+            return false;
+        }
+        if constexpr (std::is_same_v<V, std::string>) {
+            v = s;
+            return true;
+        } else {
+            return guarded([&] { parse_enum(s, v); });
+        }
+    }
+}
+
+// =============================================================================
+// Config
+// =============================================================================
+
+struct PyConfig {
+    PyObject_HEAD
+    Config config;
+};
+
+PyTypeObject* config_type = nullptr;  ///< Created in PyInit_euler1d
+
+PyObject* Config_new(PyTypeObject* type, PyObject* /*args*/, PyObject* /*kwargs*/) {
+    auto* self = reinterpret_cast<PyConfig*>(type->tp_alloc(type, 0));
+    if (self != nullptr) {
+        new (&self->config) Config{};
+    }
+    return reinterpret_cast<PyObject*>(self);
+}
+
+/// Parse the TOML file named by a str, bytes or os.PathLike object
+bool parse_path(PyObject* path_like, Config& config) {
+    PyObject* path = nullptr;
+    if (!PyUnicode_FSConverter(path_like, &path)) {
+        return false;
+    }
+    const bool ok = guarded([&] { config = parse_config(PyBytes_AS_STRING(path)); });
+    Py_DECREF(path);
+    return ok;
+}
+
+int Config_init(PyConfig* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"path", nullptr};
+    PyObject* path = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char**>(keywords), &path)) {
+        return -1;
+    }
+    if (path == nullptr || path == Py_None) {
+        return 0;
+    }
+    return parse_path(path, self->config) ? 0 : -1;
+}
+
+void Config_dealloc(PyConfig* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    self->config.~Config();
+    type->tp_free(reinterpret_cast<PyObject*>(self));
+    Py_DECREF(type);  // Instances of heap types own a reference to their type
+}
+
+/// Attribute config.*Section.*Field
+template <auto Section, auto Field>
+PyObject* config_get(PyObject* self, void* /*closure*/) {
+    return to_python((reinterpret_cast<PyConfig*>(self)->config.*Section).*Field);
+}
+
+template <auto Section, auto Field>
+int config_set(PyObject* self, PyObject* value, void* /*closure*/) {
+    if (value == nullptr) {
+        PyErr_SetString(PyExc_AttributeError, "Config attributes cannot be deleted");
+        return -1;
+    }
+    auto field = (reinterpret_cast<PyConfig*>(self)->config.*Section).*Field;
+    if (!from_python(value, field)) {
+        return -1;
+    }
+    (reinterpret_cast<PyConfig*>(self)->config.*Section).*Field = field;
+    return 0;
+}
+
+#define EULER1D_CONFIG_ATTR(name, section, field, doc) \
+    {name, config_get<&Config::section, &decltype(Config::section)::field>, \
+     config_set<&Config::section, &decltype(Config::section)::field>, doc, nullptr}
+
+PyGetSetDef Config_getset[] = {
+    EULER1D_CONFIG_ATTR("test_name", simulation, test_name, "Case name used for output files"),
+    EULER1D_CONFIG_ATTR("xmin", mesh, xmin, "Left end of the domain"),
+    EULER1D_CONFIG_ATTR("xmax", mesh, xmax, "Right end of the domain"),
+    EULER1D_CONFIG_ATTR("num_cells", mesh, num_cells, "Number of interior cells"),
+    EULER1D_CONFIG_ATTR("expand", mesh, expand, "Grow a window around the initial discontinuities"),
+    EULER1D_CONFIG_ATTR("cfl", time, cfl, "CFL number"),
+    EULER1D_CONFIG_ATTR("final_time", time, final_time, "End time of run()"),
+    EULER1D_CONFIG_ATTR("time_integrator", time, integrator, "'euler', 'ssprk3', 'muscl_hancock', 'ader', 'backward_euler' or 'bdf2'"),
+    EULER1D_CONFIG_ATTR("max_retries", time, max_retries, "Watchdog rollbacks before giving up"),
+    EULER1D_CONFIG_ATTR("linear_solver", time, linear_solver, "'thomas' or 'pcr' (implicit integrators)"),
+    EULER1D_CONFIG_ATTR("order", numerics, order, "1 (first order) or 2 (MUSCL)"),
+    EULER1D_CONFIG_ATTR("flux", numerics, flux, "Numerical flux scheme"),
+    EULER1D_CONFIG_ATTR("limiter", numerics, limiter, "Slope limiter"),
+    EULER1D_CONFIG_ATTR("positivity", numerics, positivity, "Positivity guard (order 2)"),
+    EULER1D_CONFIG_ATTR("hybrid_flux", numerics, hybrid_flux, "LLF where the shock sensor sees no jump"),
+    EULER1D_CONFIG_ATTR("sensor_threshold", numerics, sensor_threshold, "Relative jump that flags a face (hybrid_flux)"),
+    EULER1D_CONFIG_ATTR("gamma", eos, gamma, "Ratio of specific heats"),
+    EULER1D_CONFIG_ATTR("boundary_left", boundary, left, "Left boundary condition"),
+    EULER1D_CONFIG_ATTR("boundary_right", boundary, right, "Right boundary condition"),
+    EULER1D_CONFIG_ATTR("precision", execution, precision, "'double', 'float' or 'mixed'"),
+    EULER1D_CONFIG_ATTR("threads", execution, threads, "Subdomain threads (0 = hardware concurrency)"),
+    EULER1D_CONFIG_ATTR("tile_cells", execution, tile_cells, "Cells per cache tile (0 = untiled)"),
+    EULER1D_CONFIG_ATTR("active_regions", execution, active_regions, "Step only the cells near non-uniform data"),
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+#undef EULER1D_CONFIG_ATTR
+
+// =============================================================================
+// Solver
+// =============================================================================
+
+/// Solver in the precision mode selected by the configuration (solvers are not movable)
+struct SolverHandle {
+    std::variant<BasicSolver<double>, BasicSolver<float>, BasicSolver<float, double>> solver;
+};
+
+struct PySolver {
+    PyObject_HEAD
+    SolverHandle* handle;
+    Py_ssize_t shape[2];    ///< Buffer shape (num_cells, num_components)
+    Py_ssize_t strides[2];  ///< Buffer strides in bytes
+    Py_ssize_t exports;     ///< Buffers handed out and not yet released
+    bool expand;            ///< MeshConfig::expand: stepping may move and resize the state
+};
+
+PyTypeObject* solver_type = nullptr;  ///< Created in PyInit_euler1d
+
+SolverHandle* make_handle(const Config& config) {
+    switch (config.execution.precision) {
+        case Precision::Float:
+            return new SolverHandle{decltype(SolverHandle::solver){std::in_place_type<BasicSolver<float>>, config}};
+        case Precision::Mixed:
+            return new SolverHandle{
+                decltype(SolverHandle::solver){std::in_place_type<BasicSolver<float, double>>, config}};
+        case Precision::Double:
+            break;
+    }
+    return new SolverHandle{decltype(SolverHandle::solver){std::in_place_type<BasicSolver<double>>, config}};
+}
+
+template <typename F>
+decltype(auto) visit_solver(PyObject* self, F&& f) {
+    return std::visit(std::forward<F>(f), reinterpret_cast<PySolver*>(self)->handle->solver);
+}
+
+int Solver_init(PySolver* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"config", nullptr};
+    PyObject* arg = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", const_cast<char**>(keywords), &arg)) {
+        return -1;
+    }
+    if (self->handle != nullptr) {
+        PyErr_SetString(PyExc_RuntimeError, "Solver is already initialised");
+        return -1;
+    }
+
+    // Accept a Config or a path to a TOML file
+    Config config;
+    if (PyObject_TypeCheck(arg, config_type)) {
+        config = reinterpret_cast<PyConfig*>(arg)->config;
+    } else if (!parse_path(arg, config)) {
+        return -1;
+    }
+
+    if (!guarded([&] { self->handle = make_handle(config); })) {
+        return -1;
+    }
+    const auto itemsize = visit_solver(reinterpret_cast<PyObject*>(self), [](const auto& s) {
+        using Value = typename std::remove_cvref_t<decltype(s)>::Conservative::value_type;
+        return static_cast<Py_ssize_t>(sizeof(Value));
+    });
+    self->shape[1] = static_cast<Py_ssize_t>(num_components);
+    self->strides[0] = static_cast<Py_ssize_t>(num_components) * itemsize;
+    self->strides[1] = itemsize;
+    self->expand = config.mesh.expand;
+    return 0;
+}
+
+void Solver_dealloc(PySolver* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    delete self->handle;
+    type->tp_free(reinterpret_cast<PyObject*>(self));
+    Py_DECREF(type);
+}
+
+bool check_initialised(PyObject* self) {
+    if (reinterpret_cast<PySolver*>(self)->handle == nullptr) {
+        PyErr_SetString(PyExc_RuntimeError, "Solver is not initialised");
+        return false;
+    }
+    return true;
+}
+
+/// Interior cells of the solver; with mesh.expand they change as the window grows
+Py_ssize_t num_cells(PyObject* self) {
+    return static_cast<Py_ssize_t>(visit_solver(self, [](const auto& s) { return s.mesh().num_cells(); }));
+}
+
+/// Growing the window of mesh.expand moves the state, so it must not happen under an exported buffer
+bool check_no_exports(PyObject* self) {
+    const auto* solver = reinterpret_cast<PySolver*>(self);
+    if (solver->expand && solver->exports > 0) {
+        PyErr_SetString(PyExc_BufferError,
+                        "mesh.expand may move the state: release the views of Solver.state before stepping");
+        return false;
+    }
+    return true;
+}
+
+/// Buffer over the interior cells: (num_cells, num_components) of the storage precision, writable
+int Solver_getbuffer(PyObject* self, Py_buffer* view, int flags) {
+    if (!check_initialised(self)) {
+        view->obj = nullptr;
+        return -1;
+    }
+    auto* solver = reinterpret_cast<PySolver*>(self);
+    const auto [data, format] = visit_solver(self, [](auto& s) {
+        using Value = typename std::remove_cvref_t<decltype(s)>::Conservative::value_type;
+        return std::pair{static_cast<void*>(&s.interior().front().rho), std::is_same_v<Value, double> ? "d" : "f"};
+    });
+
+    solver->shape[0] = num_cells(self);
+    ++solver->exports;
+    view->buf = data;
+    view->obj = Py_NewRef(self);  // Keeps the solver alive while the view exists
+    view->itemsize = solver->strides[1];
+    view->len = solver->shape[0] * solver->strides[0];
+    view->readonly = 0;
+    view->ndim = 2;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(format) : nullptr;
+    // C-contiguous, so shape and strides may be left out when not requested
+    view->shape = ((flags & PyBUF_ND) == PyBUF_ND) ? solver->shape : nullptr;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? solver->strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+void Solver_releasebuffer(PyObject* self, Py_buffer* /*view*/) {
+    --reinterpret_cast<PySolver*>(self)->exports;
+}
+
+/// New (rows, cols) double memoryview filled by fill(double*)
+template <typename F>
+PyObject* new_matrix(Py_ssize_t rows, Py_ssize_t cols, F&& fill) {
+    PyObject* bytes = PyByteArray_FromStringAndSize(nullptr, rows * cols * static_cast<Py_ssize_t>(sizeof(double)));
+    if (bytes == nullptr) {
+        return nullptr;
+    }
+    fill(reinterpret_cast<double*>(PyByteArray_AS_STRING(bytes)));
+    PyObject* flat = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if (flat == nullptr) {
+        return nullptr;
+    }
+    PyObject* view = cols == 1 ? PyObject_CallMethod(flat, "cast", "s", "d")
+                               : PyObject_CallMethod(flat, "cast", "s(nn)", "d", rows, cols);
+    Py_DECREF(flat);
+    return view;
+}
+
+PyObject* Solver_step(PyObject* self, PyObject* args) {
+    double dt = 0.0;
+    if (!check_initialised(self) || !check_no_exports(self) || !PyArg_ParseTuple(args, "d", &dt)) {
+        return nullptr;
+    }
+    if (!guarded_nogil([&] { visit_solver(self, [dt](auto& s) { s.step(static_cast<Real>(dt)); }); })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* Solver_advance_to(PyObject* self, PyObject* args) {
+    double t = 0.0;
+    if (!check_initialised(self) || !check_no_exports(self) || !PyArg_ParseTuple(args, "d", &t)) {
+        return nullptr;
+    }
+    if (!guarded_nogil([&] { visit_solver(self, [t](auto& s) { s.advance_to(static_cast<Real>(t)); }); })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* Solver_run(PyObject* self, PyObject* /*unused*/) {
+    if (!check_initialised(self) || !check_no_exports(self) ||
+        !guarded_nogil([&] { visit_solver(self, [](auto& s) { s.run(); }); })) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* Solver_compute_dt(PyObject* self, PyObject* /*unused*/) {
+    double dt = 0.0;
+    if (!check_initialised(self) ||
+        !guarded([&] { dt = static_cast<double>(visit_solver(self, [](const auto& s) { return s.compute_dt(); })); })) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(dt);
+}
+
+PyObject* Solver_primitive(PyObject* self, PyObject* /*unused*/) {
+    if (!check_initialised(self)) {
+        return nullptr;
+    }
+    const Py_ssize_t n = num_cells(self);
+    return new_matrix(n, static_cast<Py_ssize_t>(num_components), [self](double* out) {
+        visit_solver(self, [out](const auto& s) {
+            const auto W = s.to_primitive();
+            const auto& mesh = s.mesh();
+            for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
+                const auto& W_i = W[static_cast<std::size_t>(i)];
+                const auto row = num_components * static_cast<std::size_t>(i - mesh.first_interior());
+                for (std::size_t k = 0; k < num_components; ++k) {
+                    out[row + k] = static_cast<double>(W_i[k]);
+                }
+            }
+        });
+    });
+}
+
+PyObject* Solver_set_verbose(PyObject* self, PyObject* args) {
+    int verbose = 0;
+    if (!check_initialised(self) || !PyArg_ParseTuple(args, "p", &verbose)) {
+        return nullptr;
+    }
+    visit_solver(self, [verbose](auto& s) { s.set_verbose(verbose != 0); });
+    Py_RETURN_NONE;
+}
+
+PyMethodDef Solver_methods[] = {
+    {"step", Solver_step, METH_VARARGS, "step(dt): advance by one step of size dt"},
+    {"advance_to", Solver_advance_to, METH_VARARGS, "advance_to(t): CFL-limited steps until time t"},
+    {"run", Solver_run, METH_NOARGS, "run(): advance to the configured final time"},
+    {"compute_dt", Solver_compute_dt, METH_NOARGS, "compute_dt(): stable timestep for the current state"},
+    {"primitive", Solver_primitive, METH_NOARGS, "primitive(): (num_cells, num_components) copy of (rho, u, p, phi_k...)"},
+    {"set_verbose", Solver_set_verbose, METH_VARARGS, "set_verbose(flag): print progress to stdout"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyObject* Solver_get_state(PyObject* self, void* /*closure*/) {
+    return PyMemoryView_FromObject(self);
+}
+
+PyObject* Solver_get_x(PyObject* self, void* /*closure*/) {
+    if (!check_initialised(self)) {
+        return nullptr;
+    }
+    const Py_ssize_t n = num_cells(self);
+    return new_matrix(n, 1, [self](double* out) {
+        visit_solver(self, [out](const auto& s) {
+            const auto& mesh = s.mesh();
+            for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
+                out[i - mesh.first_interior()] = static_cast<double>(mesh.x(i));
+            }
+        });
+    });
+}
+
+PyObject* Solver_get_time(PyObject* self, void* /*closure*/) {
+    if (!check_initialised(self)) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(static_cast<double>(visit_solver(self, [](const auto& s) { return s.time(); })));
+}
+
+PyObject* Solver_get_steps(PyObject* self, void* /*closure*/) {
+    if (!check_initialised(self)) {
+        return nullptr;
+    }
+    return PyLong_FromLong(visit_solver(self, [](const auto& s) { return s.steps(); }));
+}
+
+PyObject* Solver_get_precision(PyObject* self, void* /*closure*/) {
+    if (!check_initialised(self)) {
+        return nullptr;
+    }
+    return PyUnicode_FromString(visit_solver(self, [](const auto& s) { return s.precision_name(); }));
+}
+
+PyGetSetDef Solver_getset[] = {
+    {"state", Solver_get_state, nullptr, "Writable (num_cells, num_components) view of (rho, rho*u, E, rho*phi_k...), no copy", nullptr},
+    {"x", Solver_get_x, nullptr, "Cell centres of the interior cells", nullptr},
+    {"time", Solver_get_time, nullptr, "Current simulation time", nullptr},
+    {"steps", Solver_get_steps, nullptr, "Number of steps taken so far", nullptr},
+    {"precision", Solver_get_precision, nullptr, "Precision mode of the solver", nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+PyType_Slot Config_slots[] = {
+    {Py_tp_doc, const_cast<char*>("Config(path=None): solver configuration, optionally read from a TOML file")},
+    {Py_tp_new, reinterpret_cast<void*>(Config_new)},
+    {Py_tp_init, reinterpret_cast<void*>(Config_init)},
+    {Py_tp_dealloc, reinterpret_cast<void*>(Config_dealloc)},
+    {Py_tp_getset, Config_getset},
+    {0, nullptr}
+};
+
+PyType_Spec Config_spec = {"euler1d.Config", sizeof(PyConfig), 0, Py_TPFLAGS_DEFAULT, Config_slots};
+
+PyType_Slot Solver_slots[] = {
+    {Py_tp_doc, const_cast<char*>("Solver(config): solver for a Config or a TOML file path")},
+    {Py_tp_new, reinterpret_cast<void*>(PyType_GenericNew)},
+    {Py_tp_init, reinterpret_cast<void*>(Solver_init)},
+    {Py_tp_dealloc, reinterpret_cast<void*>(Solver_dealloc)},
+    {Py_tp_methods, Solver_methods},
+    {Py_tp_getset, Solver_getset},
+    {Py_bf_getbuffer, reinterpret_cast<void*>(Solver_getbuffer)},
+    {Py_bf_releasebuffer, reinterpret_cast<void*>(Solver_releasebuffer)},
+    {0, nullptr}
+};
+
+PyType_Spec Solver_spec = {"euler1d.Solver", sizeof(PySolver), 0, Py_TPFLAGS_DEFAULT, Solver_slots};
+
+PyModuleDef euler1d_module = {
+    PyModuleDef_HEAD_INIT,
+    "euler1d",
+    "1D compressible Euler finite volume solver",
+    -1,
+    nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit_euler1d(void) {
+    config_type = reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&Config_spec));
+    solver_type = reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&Solver_spec));
+    if (config_type == nullptr || solver_type == nullptr) {
+        return nullptr;
+    }
+
+    PyObject* module = PyModule_Create(&euler1d_module);
+    if (module == nullptr) {
+        return nullptr;
+    }
+    if (PyModule_AddObjectRef(module, "Config", reinterpret_cast<PyObject*>(config_type)) < 0 ||
+        PyModule_AddObjectRef(module, "Solver", reinterpret_cast<PyObject*>(solver_type)) < 0 ||
+        PyModule_AddIntConstant(module, "num_components", static_cast<long>(num_components)) < 0) {
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
@@ -4,18 +4,24 @@
  */
 
 #include "euler1d/solver/factory.hpp"
+#include "euler1d/config/parser.hpp"
+#include <string>
 
 namespace euler1d {
 
 /// Create EOS from config
-EosVariant create_eos(const EosConfig& config) {
+template <typename T>
+BasicEosVariant<T> create_eos(const EosConfig& config) {
     switch (config.model) {
         case EosModel::IdealGas:
-            return IdealGas{config.gamma};
+            return BasicIdealGas<T>{static_cast<T>(config.gamma)};
     }
-    return IdealGas{};
+    return BasicIdealGas<T>{};
 }
 
+template BasicEosVariant<float> create_eos<float>(const EosConfig&);
+template BasicEosVariant<double> create_eos<double>(const EosConfig&);
+
 /// Create flux scheme from config
 FluxVariant create_flux(FluxScheme scheme) {
     switch (scheme) {
@@ -24,6 +30,13 @@ FluxVariant create_flux(FluxScheme scheme) {
         case FluxScheme::HLL: return HLLFlux{};
         case FluxScheme::HLLC: return HLLCFlux{};
         case FluxScheme::MoversLE: return MoversLEFlux{};
+        case FluxScheme::StegerWarming: return StegerWarmingFlux{};
+        case FluxScheme::VanLeer: return VanLeerFlux{};
+        case FluxScheme::AUSMPlus: return AUSMPlusFlux{};
+        case FluxScheme::AUSMPlusUp: return AUSMPlusUpFlux{};
+        case FluxScheme::Roe: return RoeFlux{};
+        case FluxScheme::HLLE: return HLLEFlux{};
+        case FluxScheme::KurganovTadmor: return KurganovTadmorFlux{};
     }
     return LLFFlux{};
 }
@@ -55,8 +68,51 @@ TimeIntegratorVariant create_time_integrator(TimeIntegrator integ) {
     switch (integ) {
         case TimeIntegrator::ExplicitEuler: return ExplicitEuler{};
         case TimeIntegrator::SSPRK3: return SSPRK3{};
+        case TimeIntegrator::MUSCLHancock: return MUSCLHancock{};
+        case TimeIntegrator::ADER: return ADER{};
+        case TimeIntegrator::BackwardEuler: return BackwardEuler{};
+        case TimeIntegrator::BDF2: return BDF2{};
     }
     return SSPRK3{};
 }
 
+/// Create source term from config
+template <typename T>
+BasicSourceVariant<T> create_source(const SourceConfig& config, const Mesh1D& mesh) {
+    switch (config.type) {
+        case SourceType::None:
+            return NoSource{};
+        case SourceType::Geometric: {
+            BasicGeometricSource<T> source;
+            source.area_ratio.assign(static_cast<std::size_t>(mesh.total_cells()), T{0});
+            for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
+                // Horner evaluation of A(x) and A'(x)
+                const double x = static_cast<double>(mesh.x(i));
+                double area = 0.0;
+                double slope = 0.0;
+                for (auto c = config.area.rbegin(); c != config.area.rend(); ++c) {
+                    slope = slope * x + area;
+                    area = area * x + static_cast<double>(*c);
+                }
+                if (!(area > 0.0)) {
+                    throw ConfigError("source.area must be positive on the mesh, but A(" + std::to_string(x) +
+                                      ") = " + std::to_string(area));
+                }
+                source.area_ratio[static_cast<std::size_t>(i)] = static_cast<T>(slope / area);
+            }
+            return source;
+        }
+        case SourceType::Gravity:
+            return BasicGravitySource<T>{static_cast<T>(config.gravity)};
+        case SourceType::Reaction:
+            return BasicReactionSource<T>{static_cast<T>(config.rate_constant),
+                                          static_cast<T>(config.activation_temperature),
+                                          static_cast<T>(config.heat_release)};
+    }
+    return NoSource{};
+}
+
+template BasicSourceVariant<float> create_source<float>(const SourceConfig&, const Mesh1D&);
+template BasicSourceVariant<double> create_source<double>(const SourceConfig&, const Mesh1D&);
+
 }  // namespace euler1d
@@ -5,38 +5,90 @@
 
 #include "euler1d/solver/solver.hpp"
 #include "euler1d/solver/factory.hpp"
+#include "euler1d/config/parser.hpp"
+#include "euler1d/io/output.hpp"
+#include "euler1d/mesh/mesh_hierarchy.hpp"
+#include "euler1d/parallel/communicator.hpp"
+#include "euler1d/reconstruction/positivity.hpp"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <format>
+#include <limits>
+#include <memory>
 #include <print>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 namespace euler1d {
 
-Solver::Solver(const Config& config)
-    : config_{config},
+template <typename T, typename Acc>
+BasicSolver<T, Acc>::BasicSolver(const Config& config, Arena* arena)
+    : arena_{arena},
+      config_{config},
       mesh_{config.mesh.xmin, config.mesh.xmax, config.mesh.num_cells},
-      eos_{create_eos(config.eos)},
+      eos_{create_eos<Acc>(config.eos)},
       flux_{create_flux(config.numerics.flux)},
       limiter_{create_limiter(config.numerics.limiter)},
       bc_left_{create_boundary(config.boundary.left)},
       bc_right_{create_boundary(config.boundary.right)},
       time_integrator_{create_time_integrator(config.time.integrator)},
       initial_condition_{create_initial_condition(config.initial_condition)},
-      order_{config.numerics.order} {
+      source_{create_source<Acc>(config.source, mesh_)},
+      order_{config.time.integrator == TimeIntegrator::ADER           ? 3
+             : config.time.integrator == TimeIntegrator::MUSCLHancock ? 2
+                                                                      : config.numerics.order} {
+
+    // MeshConfig::expand: step a window of the configured mesh, grown with the waves
+    validate_expand(config);
+    int storage_cells = mesh_.num_cells();
+    if (config.mesh.expand) {
+        const auto [first, count] = initial_window();
+        window_first_ = first;
+        mesh_ = window_mesh(first, count);
+        // Headroom for the window to grow into as large again
+        std::tie(storage_first_, storage_cells) = storage_range(first, count, 2 * count);
+    }
+    window_stats_.peak_cells = mesh_.num_cells();
 
-    // Allocate solution arrays
     const auto n = static_cast<std::size_t>(mesh_.total_cells());
-    U_.resize(n);
-    W_.resize(n);
-    fluxes_.resize(n + 1);  // n+1 interfaces
+    const auto storage_n = static_cast<std::size_t>(storage_cells + 2 * Mesh1D::num_ghosts);
+    const auto& execution = config.execution;
+    if (arena_ == nullptr && (execution.huge_pages != HugePages::None || execution.first_touch)) {
+        owned_arena_ = std::make_unique<Arena>(arena_bytes(storage_n), execution.huge_pages);
+        if (execution.first_touch) {
+            owned_arena_->set_first_touch(num_ranks());
+        }
+        arena_ = owned_arena_.get();
+    }
 
-    // Apply initial condition
-    std::visit([this](const auto& eos) {
-        std::visit([this, &eos](const auto& ic) {
-            ic.apply(U_, mesh_, eos);
+    // Allocate solution arrays. Containers bind to the arena current when
+    // they are created, so the workspaces are recreated here as well.
+    const ArenaScope scope(arena_);
+    U_storage_ = BasicConservativeArray<T>(storage_n);
+    U_ = std::span<Conservative>(U_storage_).subspan(static_cast<std::size_t>(window_first_ - storage_first_), n);
+    W_ = BasicPrimitiveArray<T>(n);
+    dW_ = BasicPrimitiveArray<T>(cell_slopes() ? n : 0);
+    fluxes_ = BasicConservativeArray<Acc>(n + 1);  // n+1 interfaces
+    cells_ = CellWorkspace{};
+    size_cell_workspace(cells_, n);
+    reserve_workspaces(storage_n);
+    tile_ = TileWorkspace{};
+    active_ = ActiveWorkspace{};
+    implicit_ = ImplicitWorkspace{};
+    steady_ = SteadyWorkspace{};
+
+    // Apply initial condition in the accumulation precision, then store
+    BasicConservativeArray<Acc> U_init(n);
+    std::visit([this, &U_init](const auto& eos) {
+        std::visit([this, &eos, &U_init](const auto& ic) {
+            ic.apply(U_init, mesh_, eos);
         }, initial_condition_);
     }, eos_);
+    std::transform(U_init.begin(), U_init.end(), U_.begin(),
+                   [](const AccConservative& U) { return precision_cast<T>(U); });
 
     // Apply boundary conditions
     apply_boundaries();
@@ -45,159 +97,1494 @@ Solver::Solver(const Config& config)
     update_primitives();
 }
 
-void Solver::apply_boundaries() {
-    apply_left_boundary(bc_left_, U_, mesh_);
-    apply_right_boundary(bc_right_, U_, mesh_);
+template <typename T, typename Acc>
+std::size_t BasicSolver<T, Acc>::arena_bytes(std::size_t cells) noexcept {
+    // Solution, primitives, slopes, stage input, retained watchdog copy and
+    // the three RK stages in storage precision; fluxes, initial condition and
+    // RHS in accumulation precision. Larger workspaces (implicit, steady)
+    // overflow to the heap.
+    constexpr std::size_t per_cell = 8 * sizeof(Conservative) + 3 * sizeof(AccConservative);
+    constexpr std::size_t padding = 16 * Arena::alignment;
+    return (cells + 1) * per_cell + padding;
 }
 
-void Solver::update_primitives() {
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::size_cell_workspace(CellWorkspace& cells, std::size_t n) const {
+    if (order_ < 2) {
+        if (split_flux()) {
+            cells.split.resize(n);
+        } else {
+            cells.states.resize(n);
+        }
+        if (roe_averaged_flux()) {
+            cells.roe.resize(n);
+        }
+    }
+    if (ader()) {
+        cells.ader.resize(n);
+    }
+    if (hybrid_flux()) {
+        cells.faces.resize(n);
+    }
+    if (config_.numerics.positivity && order_ >= 2) {
+        cells.fallback_faces.reserve(n + 1);  // At most every face
+    }
+    cells.stage.resize(n);
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::apply_boundaries() {
+    apply_left_boundary<T>(bc_left_, U_, mesh_);
+    apply_right_boundary<T>(bc_right_, U_, mesh_);
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::update_primitives() {
     std::visit([this](const auto& eos) {
         for (std::size_t i = 0; i < U_.size(); ++i) {
-            W_[i] = eos.to_primitive(U_[i]);
+            W_[i] = precision_cast<T>(eos.to_primitive(precision_cast<Acc>(U_[i])));
         }
     }, eos_);
 }
 
-Real Solver::compute_dt() const {
-    Real max_speed = Real{0};
+template <typename T, typename Acc>
+auto BasicSolver<T, Acc>::scan_state(std::span<const Conservative> U, int first, int last) const -> StateScan {
+    StateScan scan;
+    int unhealthy = 0;
 
-    std::visit([this, &max_speed](const auto& eos) {
-        for (int i = mesh_.first_interior(); i <= mesh_.last_interior(); ++i) {
-            const auto& U = U_[static_cast<std::size_t>(i)];
-            const Real u = std::abs(U.rho_u / U.rho);
-            const Real c = eos.sound_speed(U);
-            max_speed = std::max(max_speed, u + c);
+    std::visit([&U, &scan, &unhealthy, first, last](const auto& eos) {
+        for (int i = first; i <= last; ++i) {
+            const auto U_i = precision_cast<Acc>(U[static_cast<std::size_t>(i)]);
+            const Acc u = std::abs(U_i.rho_u / U_i.rho);
+            const Acc c = eos.sound_speed(U_i);
+            scan.max_speed = std::max(scan.max_speed, u + c);
+            // Counted without short-circuiting so the loop still vectorizes
+            unhealthy += static_cast<int>(!(is_finite_bits(U_i) & eos.is_admissible(U_i)));
+        }
+        if (unhealthy > 0) [[unlikely]] {
+            for (int i = first; i <= last; ++i) {
+                const auto U_i = precision_cast<Acc>(U[static_cast<std::size_t>(i)]);
+                if (!is_finite_bits(U_i) || !eos.is_admissible(U_i)) {
+                    scan.first_bad = i;
+                    break;
+                }
+            }
         }
     }, eos_);
 
-    if (max_speed < constants::epsilon) {
-        max_speed = Real{1};  // Avoid division by zero
+    return scan;
+}
+
+template <typename T, typename Acc>
+Real BasicSolver<T, Acc>::compute_dt() const {
+    const auto scan = scan_state(U_, mesh_.first_interior(), mesh_.last_interior());
+    if (scan.first_bad >= 0) {
+        throw std::runtime_error(std::format("Non-physical state at cell {} (x = {:.6g})",
+                                             scan.first_bad - mesh_.first_interior(), mesh_.x(scan.first_bad)));
+    }
+    return dt_from_speed(scan.max_speed);
+}
+
+template <typename T, typename Acc>
+Real BasicSolver<T, Acc>::dt_from_speed(Acc max_speed) const {
+    if (max_speed < constants::epsilon_v<Acc>) {
+        max_speed = Acc{1};  // Avoid division by zero
     }
 
-    return config_.time.cfl * mesh_.dx() / max_speed;
+    return config_.time.cfl * mesh_.dx() / static_cast<Real>(max_speed);
 }
 
-void Solver::compute_rhs(std::span<const ConservativeVars> U, std::span<ConservativeVars> dU) {
-    // Update primitives from U
-    std::visit([&U, this](const auto& eos) {
-        for (std::size_t i = 0; i < U.size(); ++i) {
-            W_[i] = eos.to_primitive(U[i]);
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::compute_rhs(std::span<const Conservative> U, std::span<AccConservative> dU, Acc dt) {
+    compute_rhs(U, dU, W_, dW_, fluxes_, cells_, dt, 0);
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::compute_rhs(std::span<const Conservative> U, std::span<AccConservative> dU,
+                                      std::span<Primitive> W, std::span<Primitive> dW,
+                                      std::span<AccConservative> fluxes, CellWorkspace& cells, Acc dt,
+                                      int cell_offset, AccConservative* residual_sq) const {
+    const int first = Mesh1D::num_ghosts;
+    const int last = static_cast<int>(U.size()) - Mesh1D::num_ghosts - 1;
+
+    // Second order reconstructs from the primitives; first order evaluates
+    // each cell's state (or split fluxes, below) once for both of its faces.
+    // ADER reconstructs the conservative variables in its predictor below.
+    std::visit([&U, &W, &cells, this](const auto& eos) {
+        if (order_ < 2) {
+            if (!split_flux()) {
+                cells.states.fill(U, eos);
+            }
+        } else if (!ader()) {
+            for (std::size_t i = 0; i < U.size(); ++i) {
+                W[i] = precision_cast<T>(eos.to_primitive(precision_cast<Acc>(U[i])));
+            }
         }
     }, eos_);
 
+    // Each cell's slope is limited once and shared by both of its faces
+    const bool shared_slopes = cell_slopes();
+    if (shared_slopes) {
+        BasicMUSCLReconstruction<T>::limit_slopes(std::span<const Primitive>(W), dW, limiter_);
+    }
+
+    // Positivity guard for the reconstructed scheme. Reconstructed states are
+    // pulled towards their cell average where they would lose positivity
+    // (Zhang-Shu scaling). The forward Euler update of cell i then splits into
+    // two half-updates, one per face:
+    //   U_i - 2*lambda*(F_{i+1/2} - f(U_i))  and  U_i + 2*lambda*(F_{i-1/2} - f(U_i)).
+    // Their average is the full update, so if both are admissible so is the
+    // cell. A face whose half-update fails falls back to the first-order flux,
+    // which keeps it admissible for CFL <= 1/2 with LLF/HLL.
+    const bool guard = config_.numerics.positivity && order_ >= 2 && dt > Acc{0};
+    std::int64_t limited_states = 0;
+    std::int64_t fallback_faces = 0;
+
+    // MUSCL-Hancock predictor: both face states of a cell are evolved over
+    // dt/2 by the flux difference across the cell,
+    //   U^-+ = U(W_i -+ dW_i) + dt/(2 dx) * (F(U^-) - F(U^+)),
+    // and the Riemann problems are posed between the evolved states
+    const bool predict = hancock() && dt > Acc{0};
+
+    // Hybrid flux: LLF where the shock sensor sees smooth data
+    const bool hybrid = hybrid_flux();
+    std::int64_t smooth_faces = 0;
+    std::int64_t sharp_faces = 0;
+
+    // ADER predictor: time-averaged face states and physical fluxes of every
+    // cell next to a face, in one pass over the cells
+    if (ader()) {
+        std::visit([&](const auto& eos) {
+            limited_states += cells.ader.predict(U, eos, dt, static_cast<Acc>(mesh_.dx()),
+                                                 static_cast<std::size_t>(first - 1),
+                                                 static_cast<std::size_t>(last + 1), guard);
+        }, eos_);
+    }
+
     // Compute fluxes at each interface
-    std::visit([this, &U](const auto& eos) {
-        std::visit([this, &eos, &U](const auto& flux_scheme) {
-            const int first = mesh_.first_interior();
-            const int last = mesh_.last_interior();
+    std::visit([&](const auto& eos) {
+        std::visit([&](const auto& flux_scheme) {
+            if (ader()) {
+                // One Riemann solve between the time-averaged states, plus the
+                // average of F over the step minus F of the averaged states
+                const auto& pred = cells.ader;
+                for (int i = first - 1; i <= last; ++i) {
+                    const auto l = static_cast<std::size_t>(i);
+                    const auto r = l + 1;
+                    const auto state_L = make_cell_state(pred.U_plus[l], eos);
+                    const auto state_R = make_cell_state(pred.U_minus[r], eos);
+                    fluxes[r] = flux_scheme(state_L, state_R, eos) +
+                                Acc{0.5} * ((pred.F_plus[l] - state_L.F) + (pred.F_minus[r] - state_R.F));
+                }
+                return;
+            }
 
-            // Loop over interfaces (from first interior left face to last interior right face)
-            for (int i = first - 1; i <= last; ++i) {
-                ConservativeVars U_L, U_R;
+            if (predict) {
+                const Acc half_lambda = Acc{0.5} * dt / static_cast<Acc>(mesh_.dx());
+                AccConservative U_plus_left{};  // Evolved right face state of the previous cell
+                for (int i = first - 1; i <= last + 1; ++i) {
+                    const auto k = static_cast<std::size_t>(i);
+                    auto W_minus = W[k] - dW[k];
+                    auto W_plus = W[k] + dW[k];
+                    if (guard && !(is_positive(W_minus) && is_positive(W_plus))) [[unlikely]] {
+                        limited_states += scale_to_positive(W_minus, W[k]);
+                        limited_states += scale_to_positive(W_plus, W[k]);
+                    }
+                    const auto U_minus = eos.to_conservative(precision_cast<Acc>(W_minus));
+                    const auto U_plus = eos.to_conservative(precision_cast<Acc>(W_plus));
+                    const auto dF = half_lambda * (eos.flux(U_minus) - eos.flux(U_plus));
+                    auto U_minus_evolved = U_minus + dF;
+                    auto U_plus_evolved = U_plus + dF;
+                    const bool lost = guard && !(eos.is_admissible(U_minus_evolved) &&
+                                                 eos.is_admissible(U_plus_evolved));
+                    if (lost) [[unlikely]] {
+                        // Keep the unevolved (positive) states of this cell
+                        U_minus_evolved = U_minus;
+                        U_plus_evolved = U_plus;
+                        limited_states += 2;
+                    }
+                    if (i >= first) {
+                        fluxes[k] = flux_scheme(U_plus_left, U_minus_evolved, eos);
+                    }
+                    U_plus_left = U_plus_evolved;
+                }
+                return;
+            }
+
+            if constexpr (VectorSplitFlux<std::decay_t<decltype(flux_scheme)>>) {
+                if (order_ < 2) {
+                    // F+ and F- once per cell, then one addition per face
+                    cells.split.fill(U, eos, flux_scheme);
+                    for (int i = first - 1; i <= last; ++i) {
+                        fluxes[static_cast<std::size_t>(i) + 1] = cells.split(static_cast<std::size_t>(i));
+                    }
+                    return;
+                }
+            }
+
+            if constexpr (RoeAveragedFlux<std::decay_t<decltype(flux_scheme)>>) {
+                if (order_ < 2 && !hybrid) {
+                    // Roe averages of all faces in batched passes, then the flux per face
+                    cells.roe.fill(U, cells.states, eos);
+                    for (int i = first - 1; i <= last; ++i) {
+                        const auto l = static_cast<std::size_t>(i);
+                        const auto r = l + 1;
+                        fluxes[r] = flux_scheme(cells.states(l, precision_cast<Acc>(U[l])),
+                                                cells.states(r, precision_cast<Acc>(U[r])), cells.roe(l), eos);
+                    }
+                    return;
+                }
+            }
+
+            // Flux at the face between cells i and i + 1
+            const auto face_flux = [&](const auto& scheme, int i) {
+                const auto l = static_cast<std::size_t>(i);
+                const auto r = l + 1;
 
                 if (order_ >= 2) {
                     // MUSCL reconstruction
-                    auto [W_L, W_R] = MUSCLReconstruction::reconstruct(
-                        std::span<const PrimitiveVars>(W_), i, limiter_);
-                    U_L = eos.to_conservative(W_L);
-                    U_R = eos.to_conservative(W_R);
+                    auto [W_L, W_R] = shared_slopes
+                        ? BasicMUSCLReconstruction<T>::cell_states(std::span<const Primitive>(W),
+                                                                   std::span<const Primitive>(dW), i)
+                        : BasicMUSCLReconstruction<T>::reconstruct(std::span<const Primitive>(W), i, limiter_);
+                    if (guard && !(is_positive(W_L) && is_positive(W_R))) [[unlikely]] {
+                        limited_states += scale_to_positive(W_L, W[l]);
+                        limited_states += scale_to_positive(W_R, W[r]);
+                    }
+                    fluxes[r] = scheme(eos.to_conservative(precision_cast<Acc>(W_L)),
+                                       eos.to_conservative(precision_cast<Acc>(W_R)), eos);
                 } else {
-                    // First order: piecewise constant
-                    U_L = U[static_cast<std::size_t>(i)];
-                    U_R = U[static_cast<std::size_t>(i + 1)];
+                    // First order: piecewise constant, from the precomputed cell states
+                    fluxes[r] = scheme(cells.states(l, precision_cast<Acc>(U[l])),
+                                       cells.states(r, precision_cast<Acc>(U[r])), eos);
+                }
+            };
+
+            if (hybrid) {
+                // Sense the jumps of the cell averages, then run LLF over the
+                // smooth faces and the configured flux over the flagged ones
+                auto& faces = cells.faces;
+                const Acc threshold = static_cast<Acc>(config_.numerics.sensor_threshold);
+                if (order_ < 2) {
+                    // inv_rho flags the same faces as rho
+                    const auto& states = cells.states;
+                    faces.classify(first - 1, last,
+                                   [&](int i) { return states.inv_rho[static_cast<std::size_t>(i)]; },
+                                   [&](int i) { return states.p[static_cast<std::size_t>(i)]; }, threshold);
+                } else {
+                    faces.classify(first - 1, last,
+                                   [&](int i) { return static_cast<Acc>(W[static_cast<std::size_t>(i)].rho); },
+                                   [&](int i) { return static_cast<Acc>(W[static_cast<std::size_t>(i)].p); },
+                                   threshold);
+                }
+                for (std::size_t k = 0; k < faces.num_smooth; ++k) {
+                    face_flux(LLFFlux{}, faces.smooth[k]);
+                }
+                for (std::size_t k = 0; k < faces.num_sharp; ++k) {
+                    face_flux(flux_scheme, faces.sharp[k]);
                 }
+                smooth_faces = static_cast<std::int64_t>(faces.num_smooth);
+                sharp_faces = static_cast<std::int64_t>(faces.num_sharp);
+                return;
+            }
 
-                // Compute numerical flux
-                fluxes_[static_cast<std::size_t>(i + 1)] = flux_scheme(U_L, U_R, eos);
+            // Loop over interfaces (from first interior left face to last interior right face)
+            for (int i = first - 1; i <= last; ++i) {
+                face_flux(flux_scheme, i);
             }
         }, flux_);
     }, eos_);
 
     // Compute dU/dt = -dF/dx = -(F_{i+1/2} - F_{i-1/2}) / dx
-    const Real inv_dx = Real{1} / mesh_.dx();
-    const int first = mesh_.first_interior();
-    const int last = mesh_.last_interior();
+    const Acc inv_dx = Acc{1} / static_cast<Acc>(mesh_.dx());
 
     // Zero out dU
     for (std::size_t i = 0; i < dU.size(); ++i) {
-        dU[i] = ConservativeVars{};
+        dU[i] = AccConservative{};
     }
 
+    // The residual is summed by whichever loop completes dU: the source loop
+    // if there is an unsplit source, the flux difference loop otherwise
+    const bool unsplit_source = config_.source.coupling == SourceCoupling::Explicit &&
+                                !std::holds_alternative<NoSource>(source_);
+    const bool sum_flux_residual = residual_sq && !unsplit_source;
+    AccConservative flux_residual_sq{};  // Local, so the loops need not reload it through the pointer
+
     // Interior cells only
-    for (int i = first; i <= last; ++i) {
-        const auto& F_right = fluxes_[static_cast<std::size_t>(i + 1)];
-        const auto& F_left = fluxes_[static_cast<std::size_t>(i)];
-        dU[static_cast<std::size_t>(i)] = (F_left - F_right) * inv_dx;
+    if (guard) {
+        // Fused with the check whether any forward Euler update leaves the admissible set
+        bool all_admissible = true;
+        std::visit([&](const auto& eos) {
+            for (int i = first; i <= last; ++i) {
+                const auto& F_right = fluxes[static_cast<std::size_t>(i + 1)];
+                const auto& F_left = fluxes[static_cast<std::size_t>(i)];
+                const auto dU_i = (F_left - F_right) * inv_dx;
+                dU[static_cast<std::size_t>(i)] = dU_i;
+                all_admissible &= eos.is_admissible(precision_cast<Acc>(U[static_cast<std::size_t>(i)]) + dt * dU_i);
+                if (sum_flux_residual) {
+                    accumulate_squares(flux_residual_sq, dU_i);
+                }
+            }
+        }, eos_);
+        fallback_faces = apply_flux_fallback(U, dU, fluxes, cells, dt, !all_admissible,
+                                             sum_flux_residual ? &flux_residual_sq : nullptr);
+    } else {
+        for (int i = first; i <= last; ++i) {
+            const auto& F_right = fluxes[static_cast<std::size_t>(i + 1)];
+            const auto& F_left = fluxes[static_cast<std::size_t>(i)];
+            const auto dU_i = (F_left - F_right) * inv_dx;
+            dU[static_cast<std::size_t>(i)] = dU_i;
+            if (sum_flux_residual) {
+                accumulate_squares(flux_residual_sq, dU_i);
+            }
+        }
+    }
+    if (sum_flux_residual) {
+        *residual_sq += flux_residual_sq;
+    }
+
+    // Unsplit source: every RK stage sees S of its own stage state
+    if (unsplit_source) {
+        add_source(source_, eos_, U, dU, first, last, cell_offset, residual_sq);
+    }
+
+    if (limited_states > 0) {
+        positivity_.limited_states.fetch_add(limited_states, std::memory_order_relaxed);
+    }
+    if (fallback_faces > 0) {
+        positivity_.fallback_faces.fetch_add(fallback_faces, std::memory_order_relaxed);
+    }
+    if (hybrid) {
+        hybrid_.smooth_faces.fetch_add(smooth_faces, std::memory_order_relaxed);
+        hybrid_.sharp_faces.fetch_add(sharp_faces, std::memory_order_relaxed);
     }
 }
 
-PrimitiveArray Solver::to_primitive() const {
-    PrimitiveArray W(U_.size());
-    std::visit([&W, this](const auto& eos) {
-        for (std::size_t i = 0; i < U_.size(); ++i) {
-            W[i] = eos.to_primitive(U_[i]);
+template <typename T, typename Acc>
+std::int64_t BasicSolver<T, Acc>::apply_flux_fallback(std::span<const Conservative> U, std::span<AccConservative> dU,
+                                                      std::span<AccConservative> fluxes, CellWorkspace& cells,
+                                                      Acc dt, bool scan_cells, AccConservative* residual_sq) const {
+    const int first = Mesh1D::num_ghosts;
+    const int last = static_cast<int>(U.size()) - Mesh1D::num_ghosts - 1;
+    const Acc inv_dx = Acc{1} / static_cast<Acc>(mesh_.dx());
+    const Acc two_lambda = Acc{2} * dt * inv_dx;
+    std::int64_t fallback_faces = 0;
+
+    std::visit([&](const auto& eos) {
+        std::visit([&](const auto& flux_scheme) {
+            auto state = [&U](int i) { return precision_cast<Acc>(U[static_cast<std::size_t>(i)]); };
+
+            // Face f lies between cells f-1 and f; see compute_rhs for the half-update split
+            auto troubled = [&](int f) {
+                const auto U_l = state(f - 1);
+                const auto U_r = state(f);
+                const auto& F = fluxes[static_cast<std::size_t>(f)];
+                return !eos.is_admissible(U_l - two_lambda * (F - eos.flux(U_l))) ||
+                       !eos.is_admissible(U_r + two_lambda * (F - eos.flux(U_r)));
+            };
+
+            // Only faces of cells whose full update fails are examined. The two
+            // outermost faces are always examined: the cell beyond them belongs
+            // to a neighbouring tile or subdomain, which must reach the same
+            // decision for the shared face.
+            auto& faces = cells.fallback_faces;
+            faces.clear();
+            int examined = first - 1;
+            auto examine = [&](int f) {
+                if (f > examined) {
+                    examined = f;
+                    if (troubled(f)) {
+                        faces.push_back(f);
+                    }
+                }
+            };
+
+            examine(first);
+            for (int i = first; scan_cells && i <= last; ++i) {
+                if (!eos.is_admissible(state(i) + dt * dU[static_cast<std::size_t>(i)])) {
+                    examine(i);
+                    examine(i + 1);
+                }
+            }
+            examine(last + 1);
+
+            // Switch the troubled faces to first order and redo the affected cells
+            for (const int f : faces) {
+                fluxes[static_cast<std::size_t>(f)] = flux_scheme(state(f - 1), state(f), eos);
+            }
+            for (const int f : faces) {
+                for (const int i : {f - 1, f}) {
+                    if (i >= first && i <= last) {
+                        auto& dU_i = dU[static_cast<std::size_t>(i)];
+                        const auto dU_new =
+                            (fluxes[static_cast<std::size_t>(i)] - fluxes[static_cast<std::size_t>(i + 1)]) * inv_dx;
+                        if (residual_sq) {
+                            // Swap the square of the old value for that of the new one
+                            for (std::size_t k = 0; k < dU_new.size(); ++k) {
+                                (*residual_sq)[k] += (dU_new[k] - dU_i[k]) * (dU_new[k] + dU_i[k]);
+                            }
+                        }
+                        dU_i = dU_new;
+                    }
+                }
+            }
+            fallback_faces = static_cast<std::int64_t>(faces.size());
+        }, flux_);
+    }, eos_);
+
+    return fallback_faces;
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::split_source_step(std::span<Conservative> U, int first, int last, int cell_offset,
+                                            Acc dt) const {
+    if (config_.source.coupling == SourceCoupling::Strang) {
+        integrate_source(source_, eos_, U, first, last, cell_offset, dt);
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::solve_linearized(std::span<const Conservative> U, Acc alpha, std::span<AccConservative> b) {
+    constexpr std::size_t N = num_components;
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+    const auto n = static_cast<std::size_t>(mesh_.num_cells());
+    const Acc half_inv_dx = Acc{0.5} / static_cast<Acc>(mesh_.dx());
+
+    auto& A = implicit_.matrix;
+    auto& x = implicit_.x;
+    A.resize(n);
+    x.resize(n);
+
+    // Row i of -J for the Rusanov flux with face speeds lambda_{i-1/2}, lambda_{i+1/2}:
+    //   lower = -(A_{i-1} + lambda_{i-1/2}) / 2dx,  upper = (A_{i+1} - lambda_{i+1/2}) / 2dx,
+    //   diag = (lambda_{i-1/2} + lambda_{i+1/2}) / 2dx   (A_i cancels)
+    std::visit([&](const auto& eos) {
+        auto state = [&U](int i) { return precision_cast<Acc>(U[static_cast<std::size_t>(i)]); };
+        auto speed = [&eos](const AccConservative& U_i) {
+            return std::abs(U_i.rho_u / U_i.rho) + eos.sound_speed(U_i);
+        };
+
+        // Window over cells i-1, i, i+1 so each Jacobian is evaluated once
+        auto A_left = eos.flux_jacobian(state(first - 1));
+        auto A_center = eos.flux_jacobian(state(first));
+        Acc s_center = speed(state(first));
+        Acc lambda_left = std::max(speed(state(first - 1)), s_center);
+        for (int i = first; i <= last; ++i) {
+            const auto j = static_cast<std::size_t>(i - first);
+            const auto U_right = state(i + 1);
+            const auto A_right = eos.flux_jacobian(U_right);
+            const Acc s_right = speed(U_right);
+            const Acc lambda_right = std::max(s_center, s_right);
+
+            for (std::size_t r = 0; r < N; ++r) {
+                for (std::size_t c = 0; c < N; ++c) {
+                    A.lower[j][r][c] = -half_inv_dx * A_left[r][c];
+                    A.diag[j][r][c] = Acc{0};
+                    A.upper[j][r][c] = half_inv_dx * A_right[r][c];
+                }
+                A.lower[j][r][r] -= half_inv_dx * lambda_left;
+                A.diag[j][r][r] = alpha + half_inv_dx * (lambda_left + lambda_right);
+                A.upper[j][r][r] -= half_inv_dx * lambda_right;
+                x[j][r] = b[static_cast<std::size_t>(i)][r];
+            }
+
+            A_left = A_center;
+            A_center = A_right;
+            s_center = s_right;
+            lambda_left = lambda_right;
         }
     }, eos_);
-    return W;
+
+    // Ghost increments follow the adjacent interior cell: dU_g = M dU, with M
+    // flipping the momentum at a wall
+    auto fold = [](BasicBlock<Acc, N>& diag, BasicBlock<Acc, N>& coupling, const BoundaryVariant& bc) {
+        if (!std::holds_alternative<PeriodicBoundary>(bc)) {
+            const bool wall = std::holds_alternative<ReflectiveBoundary>(bc);
+            for (std::size_t r = 0; r < N; ++r) {
+                for (std::size_t c = 0; c < N; ++c) {
+                    diag[r][c] += (wall && c == 1) ? -coupling[r][c] : coupling[r][c];
+                }
+            }
+        }
+        coupling = BasicBlock<Acc, N>{};
+    };
+    fold(A.diag.front(), A.lower.front(), bc_left_);
+    fold(A.diag.back(), A.upper.back(), bc_right_);
+
+    if (config_.time.linear_solver == LinearSolver::PCR) {
+        int threads = config_.execution.threads;
+        if (threads == 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        solve_block_pcr(A, std::span(x), threads);
+    } else {
+        solve_block_thomas(A, std::span(x));
+    }
+
+    for (int i = first; i <= last; ++i) {
+        const auto j = static_cast<std::size_t>(i - first);
+        for (std::size_t r = 0; r < N; ++r) {
+            b[static_cast<std::size_t>(i)][r] = x[j][r];
+        }
+    }
 }
 
-void Solver::run() {
-    const Real t_final = config_.time.final_time;
-    int step = 0;
+template <typename T, typename Acc>
+bool BasicSolver<T, Acc>::use_tiling() const noexcept {
+    // Periodic ghosts are filled from the far end of the domain, which a
+    // tile-local copy cannot see; implicit steps couple the whole domain
+    const bool periodic = std::holds_alternative<PeriodicBoundary>(bc_left_) ||
+                          std::holds_alternative<PeriodicBoundary>(bc_right_);
+    return config_.execution.tile_cells > 0 && !periodic && !is_implicit(time_integrator_);
+}
 
-    std::println("Starting simulation: {}", config_.simulation.test_name);
-    std::println("  Domain: [{}, {}], Cells: {}", mesh_.xmin(), mesh_.xmax(), mesh_.num_cells());
-    std::println("  Final time: {}, CFL: {}", t_final, config_.time.cfl);
-    std::println("  Order: {}", order_);
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::advance_tiled(Acc dt) {
+    constexpr int ng = Mesh1D::num_ghosts;
+    const int halo = ng * num_stages(time_integrator_);
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+    const int n_total = mesh_.total_cells();
 
-    // Start timing
-    const auto start_time = std::chrono::high_resolution_clock::now();
+    // A tile must be at least as wide as the halo it hands to its neighbour
+    const int tile_cells = std::max(config_.execution.tile_cells, halo);
+    const Acc half_dt = Acc{0.5} * dt;
+
+    const auto buffer_size = static_cast<std::size_t>(tile_cells + 2 * halo);
+    tile_.U.resize(buffer_size);
+    tile_.U_stage.resize(buffer_size);
+    tile_.W.resize(buffer_size);
+    if (cell_slopes()) {
+        tile_.dW.resize(buffer_size);
+    }
+    tile_.fluxes.resize(buffer_size + 1);
+    size_cell_workspace(tile_.cells, buffer_size);
+    tile_.carry.resize(static_cast<std::size_t>(halo));
+    tile_.carry_next.resize(static_cast<std::size_t>(halo));
+
+    for (int a = first; a <= last; a += tile_cells) {
+        const int b = std::min(a + tile_cells, last + 1);  // Tile interior is [a, b)
+        const int lo = std::max(a - halo, 0);
+        const int hi = std::min(b + halo, n_total);
+        const int n_local = hi - lo;
+        const bool touches_left = (lo == 0);
+        const bool touches_right = (hi == n_total);
+
+        const std::span<Conservative> U_tile(tile_.U.data(), static_cast<std::size_t>(n_local));
+        const std::span<Conservative> U_stage(tile_.U_stage.data(), static_cast<std::size_t>(n_local));
+        const std::span<Primitive> W_tile(tile_.W.data(), static_cast<std::size_t>(n_local));
+        const std::span<Primitive> dW_tile(tile_.dW.data(), tile_.dW.empty() ? 0 : static_cast<std::size_t>(n_local));
+        const std::span<AccConservative> F_tile(tile_.fluxes.data(), static_cast<std::size_t>(n_local + 1));
+
+        // Gather: left halo from the carry (U_ there is already advanced),
+        // the rest straight from U_
+        const int n_carried = (a == first) ? 0 : a - lo;
+        std::copy_n(tile_.carry.end() - n_carried, n_carried, U_tile.begin());
+        std::copy(U_.begin() + lo + n_carried, U_.begin() + hi, U_tile.begin() + n_carried);
+
+        // Save the pre-step values the next tile needs as its left halo
+        const int n_next = std::min(halo, b - first);
+        std::copy(U_.begin() + b - n_next, U_.begin() + b, tile_.carry_next.end() - n_next);
+
+        // The split source is pointwise, so halo cells reach the same values as in their own tile
+        split_source_step(U_tile, std::max(lo, first) - lo, std::min(hi - 1, last) - lo, lo, half_dt);
+
+        // Local mesh so physical boundaries land on the tile's own ghost cells
+        const Mesh1D tile_mesh{mesh_.x_face_left(lo + ng), mesh_.x_face_left(hi - ng), n_local - 2 * ng};
+
+        auto tile_rhs = [&](std::span<const Conservative> U_in, std::span<AccConservative> dU_out) {
+            std::copy(U_in.begin(), U_in.end(), U_stage.begin());
+            if (touches_left) {
+                apply_left_boundary(bc_left_, U_stage, tile_mesh);
+            }
+            if (touches_right) {
+                apply_right_boundary(bc_right_, U_stage, tile_mesh);
+            }
+            compute_rhs(U_stage, dU_out, W_tile, dW_tile, F_tile, tile_.cells, dt, lo);
+        };
+
+        advance<T, Acc>(time_integrator_, U_tile, dt, tile_rhs);
+        split_source_step(U_tile, a - lo, b - 1 - lo, lo, half_dt);
+
+        // Scatter the tile interior back; halo results are discarded
+        std::copy(U_tile.begin() + (a - lo), U_tile.begin() + (b - lo), U_.begin() + a);
+        std::swap(tile_.carry, tile_.carry_next);
+    }
+}
+
+template <typename T, typename Acc>
+Mesh1D BasicSolver<T, Acc>::window_mesh(int first, int num_cells) const {
+    // Faces of the configured mesh, exact at its two ends
+    const auto& domain = config_.mesh;
+    const Real dx = (domain.xmax - domain.xmin) / static_cast<Real>(domain.num_cells);
+    const auto face = [&](int i) {
+        return (i == 0) ? domain.xmin : (i == domain.num_cells) ? domain.xmax : domain.xmin + static_cast<Real>(i) * dx;
+    };
+    return Mesh1D{face(first), face(first + num_cells), num_cells};
+}
+
+template <typename T, typename Acc>
+std::pair<int, int> BasicSolver<T, Acc>::initial_window() const {
+    const auto& domain = config_.mesh;
+    const Real dx = (domain.xmax - domain.xmin) / static_cast<Real>(domain.num_cells);
+
+    // Region ends inside the domain; a single region starts from the middle
+    Real x_lo = domain.xmax;
+    Real x_hi = domain.xmin;
+    for (const auto& region : config_.initial_condition.regions) {
+        for (const Real x : {region.x_left, region.x_right}) {
+            if (x > domain.xmin && x < domain.xmax) {
+                x_lo = std::min(x_lo, x);
+                x_hi = std::max(x_hi, x);
+            }
+        }
+    }
+    if (x_lo > x_hi) {
+        x_lo = x_hi = Real{0.5} * (domain.xmin + domain.xmax);
+    }
+
+    // Padded by twice the distance at which the window grows
+    const int pad = 4 * (Mesh1D::num_ghosts * num_stages(time_integrator_) + 1);
+    const int first = std::max(static_cast<int>(std::floor((x_lo - domain.xmin) / dx)) - pad, 0);
+    const int end = std::min(static_cast<int>(std::ceil((x_hi - domain.xmin) / dx)) + pad, domain.num_cells);
+    return {first, end - first};
+}
+
+template <typename T, typename Acc>
+std::pair<int, int> BasicSolver<T, Acc>::storage_range(int first, int num_cells, int min_cells) const {
+    const int domain_cells = config_.mesh.num_cells;
+    const int count = std::min(std::max(min_cells, num_cells), domain_cells);
+    const int storage_first = std::clamp(first - (count - num_cells) / 2, 0, domain_cells - count);
+    return {storage_first, count};
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::reserve_workspaces(std::size_t cells) {
+    W_.reserve(cells);
+    if (cell_slopes()) {
+        dW_.reserve(cells);
+    }
+    fluxes_.reserve(cells + 1);
+    // The cell workspace has no reserve of its own
+    const auto n = static_cast<std::size_t>(mesh_.total_cells());
+    if (cells > n) {
+        size_cell_workspace(cells_, cells);
+        size_cell_workspace(cells_, n);
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::move_window(int first, int num_cells) {
+    constexpr int ng = Mesh1D::num_ghosts;
+    const int old_first = window_first_;
+    const int old_n = mesh_.num_cells();
+    const Conservative left = U_[static_cast<std::size_t>(ng)];
+    const Conservative right = U_[static_cast<std::size_t>(ng + old_n - 1)];
+
+    const int storage_cells = static_cast<int>(U_storage_.size()) - 2 * ng;
+    if (first < storage_first_ || first + num_cells > storage_first_ + storage_cells) {
+        // Out of headroom: reallocate twice the storage and copy the window over
+        const ArenaScope scope(arena_);
+        const auto [storage_first, count] = storage_range(first, num_cells, 2 * storage_cells);
+        BasicConservativeArray<T> storage(static_cast<std::size_t>(count + 2 * ng));
+        std::copy(U_.begin(), U_.end(), storage.begin() + (old_first - storage_first));
+        U_storage_ = std::move(storage);
+        storage_first_ = storage_first;
+        reserve_workspaces(U_storage_.size());
+        ++window_stats_.reallocations;
+    }
+
+    // Grow the view in place; only the new cells are written
+    U_ = std::span<Conservative>(U_storage_).subspan(static_cast<std::size_t>(first - storage_first_),
+                                                      static_cast<std::size_t>(num_cells + 2 * ng));
+    const auto old_begin = U_.begin() + (old_first - first + ng);
+    std::fill(U_.begin(), old_begin, left);
+    std::fill(old_begin + old_n, U_.end(), right);
+    window_first_ = first;
+    mesh_ = window_mesh(first, num_cells);
+    window_stats_.peak_cells = std::max(window_stats_.peak_cells, num_cells);
+
+    const auto n = static_cast<std::size_t>(mesh_.total_cells());
+    W_.resize(n);
+    if (cell_slopes()) {
+        dW_.resize(n);
+    }
+    fluxes_.resize(n + 1);
+    size_cell_workspace(cells_, n);
+    apply_boundaries();
+    update_primitives();
+}
+
+template <typename T, typename Acc>
+bool BasicSolver<T, Acc>::expand_window() {
+    if (!config_.mesh.expand) {
+        return false;
+    }
+    // One step moves a disturbance by at most the stencil of all stages
+    const int n = mesh_.num_cells();
+    const int reach = 2 * (Mesh1D::num_ghosts * num_stages(time_integrator_) + 1);
+    const int depth = std::min(reach, n - 1);
+    const auto first = static_cast<std::size_t>(mesh_.first_interior());
+    const auto last = static_cast<std::size_t>(mesh_.last_interior());
+    bool grow_left = false;
+    bool grow_right = false;
+    for (std::size_t k = 1; k <= static_cast<std::size_t>(depth); ++k) {
+        grow_left |= cells_differ(U_[first], U_[first + k]);
+        grow_right |= cells_differ(U_[last], U_[last - k]);
+    }
+    const int extension = std::max(2 * reach, n / 2);
+    const int first_cell = grow_left ? std::max(window_first_ - extension, 0) : window_first_;
+    const int end_cell = grow_right ? std::min(window_first_ + n + extension, config_.mesh.num_cells)
+                                    : window_first_ + n;
+    if (first_cell == window_first_ && end_cell == window_first_ + n) {
+        return false;  // Already at the domain edges
+    }
+    move_window(first_cell, end_cell - first_cell);
+    ++window_stats_.extensions;
+    return true;
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::fit_window_to_domain() {
+    if (config_.mesh.expand) {
+        move_window(0, config_.mesh.num_cells);
+    }
+}
+
+template <typename T, typename Acc>
+bool BasicSolver<T, Acc>::cells_differ(const Conservative& a, const Conservative& b) noexcept {
+    // Differences at the level of rounding are not disturbances: a cell of
+    // a region that stays uniform may pick up an ulp from the RK combinations.
+    // Momentum, which may vanish, is measured against sqrt(rho * E).
+    constexpr T tolerance = T{1024} * std::numeric_limits<T>::epsilon();
+    const T scale_rho = tolerance * (a.rho + b.rho);
+    const T scale_E = tolerance * (a.E + b.E);
+    const T d_rho_u = a.rho_u - b.rho_u;
+    bool differ = (std::abs(a.rho - b.rho) > scale_rho) | (std::abs(a.E - b.E) > scale_E) |
+                  (d_rho_u * d_rho_u > scale_rho * scale_E);
+    a.for_each_scalar([&](auto k) { differ |= std::abs(a.rho_phi[k] - b.rho_phi[k]) > scale_rho; });
+    return differ;
+}
+
+template <typename T, typename Acc>
+bool BasicSolver<T, Acc>::use_active_regions() const noexcept {
+    // Periodic ghosts and implicit steps couple the whole domain, and a
+    // source changes uniform gas as well
+    const bool periodic = std::holds_alternative<PeriodicBoundary>(bc_left_) ||
+                          std::holds_alternative<PeriodicBoundary>(bc_right_);
+    return config_.execution.active_regions && !periodic && !is_implicit(time_integrator_) && !use_tiling() &&
+           std::holds_alternative<NoSource>(source_);
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::find_active_regions(Acc dt) {
+    constexpr int ng = Mesh1D::num_ghosts;
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+    const int reach = ng * num_stages(time_integrator_);
+    const Acc inv_dx = Acc{1} / static_cast<Acc>(mesh_.dx());
 
-    // Define RHS function for time integrator
-    auto rhs_func = [this](std::span<const ConservativeVars> U_in, std::span<ConservativeVars> dU_out) {
-        // Need a mutable copy for boundary application
-        ConservativeArray U_temp(U_in.begin(), U_in.end());
-        apply_left_boundary(bc_left_, U_temp, mesh_);
-        apply_right_boundary(bc_right_, U_temp, mesh_);
-        compute_rhs(U_temp, dU_out);
+    // Disturbed faces [face_first, face_last] (face i lies between cells i and i + 1)
+    auto& regions = active_.regions;
+    regions.clear();
+    const auto add_region = [&](int face_first, int face_last) {
+        const Acc max_speed = scan_state(U_, std::max(face_first, first), std::min(face_last + 1, last)).max_speed;
+        const int margin = reach + static_cast<int>(std::ceil(max_speed * dt * inv_dx));
+        const int a = std::max(face_first + 1 - margin, first);
+        const int b = std::min(face_last + margin + 1, last + 1);
+        if (!regions.empty() && a < regions.back().second + ng) {
+            regions.back().second = b;
+        } else {
+            regions.emplace_back(a, b);
+        }
     };
+    int face_first = -1;
+    int face_last = -1;
+    for (int i = first - 1; i <= last; ++i) {
+        if (cells_differ(U_[static_cast<std::size_t>(i)], U_[static_cast<std::size_t>(i) + 1])) {
+            if (face_first >= 0 && i - face_last > 2 * reach + ng) {
+                add_region(face_first, face_last);
+                face_first = -1;
+            }
+            if (face_first < 0) {
+                face_first = i;
+            }
+            face_last = i;
+        }
+    }
+    if (face_first >= 0) {
+        add_region(face_first, face_last);
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::advance_active(Acc dt) {
+    constexpr int ng = Mesh1D::num_ghosts;
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+
+    find_active_regions(dt);
+    active_.U_stage.resize(U_.size());
+    active_.edges.resize(2 * ng);
+
+    std::int64_t updated = 0;
+    for (const auto& [a, b] : active_.regions) {
+        const int lo = a - ng;
+        const auto n_local = static_cast<std::size_t>(b - a + 2 * ng);
+        const bool touches_left = (a == first);
+        const bool touches_right = (b == last + 1);
+
+        const std::span<Conservative> U_region(U_.data() + lo, n_local);
+        const std::span<Conservative> U_stage(active_.U_stage.data(), n_local);
+        const std::span<Primitive> W_region(W_.data() + lo, n_local);
+        const std::span<Primitive> dW_region = dW_.empty() ? std::span<Primitive>{}
+                                                           : std::span<Primitive>(dW_.data() + lo, n_local);
+        const std::span<AccConservative> F_region(fluxes_.data() + lo, n_local + 1);
+
+        std::copy_n(U_region.begin(), ng, active_.edges.begin());
+        std::copy_n(U_region.end() - ng, ng, active_.edges.begin() + ng);
+
+        // Local mesh so physical boundaries land on the region's own ghost cells
+        const Mesh1D region_mesh{mesh_.x_face_left(a), mesh_.x_face_left(b), b - a};
+
+        auto region_rhs = [&](std::span<const Conservative> U_in, std::span<AccConservative> dU_out) {
+            std::copy(U_in.begin(), U_in.end(), U_stage.begin());
+            if (touches_left) {
+                apply_left_boundary(bc_left_, U_stage, region_mesh);
+            }
+            if (touches_right) {
+                apply_right_boundary(bc_right_, U_stage, region_mesh);
+            }
+            compute_rhs(U_stage, dU_out, W_region, dW_region, F_region, cells_, dt, lo);
+        };
+        advance<T, Acc>(time_integrator_, U_region, dt, region_rhs);
+
+        std::copy_n(active_.edges.begin(), ng, U_region.begin());
+        std::copy_n(active_.edges.begin() + ng, ng, U_region.end() - ng);
+        updated += b - a;
+    }
+
+    cell_updates_.updated += updated;
+    cell_updates_.skipped += mesh_.num_cells() - updated;
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::watchdog_retain(Watchdog& watchdog, std::span<const Conservative> U, Real t, int step) const {
+    if (watchdog.retries > 0 && t > watchdog.t_failed) {
+        watchdog.cfl_scale = 1;
+        watchdog.retries = 0;
+    }
+    const bool due = watchdog.U_good.empty() || watchdog.retries > 0 ||
+                     step - watchdog.step_good >= Watchdog::checkpoint_interval;
+    if (due) {
+        watchdog.U_good.assign(U.begin(), U.end());
+        watchdog.first_good = window_first_;
+        watchdog.t_good = t;
+        watchdog.step_good = step;
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::watchdog_roll_back(Watchdog& watchdog, std::span<Conservative> U, Real& t, int& step,
+                                             int bad_cell, int cell_offset) const {
+    if (bad_cell >= 0) {
+        const auto U_bad = precision_cast<double>(U[static_cast<std::size_t>(bad_cell)]);
+        const int global_cell = bad_cell + cell_offset;
+        std::println(stderr, "Watchdog: non-physical state at cell {} (x = {:.6g}), t = {:.6e}, step {}: "
+                     "rho = {}, rho_u = {}, E = {}",
+                     global_cell - mesh_.first_interior(), mesh_.x(global_cell), t, step,
+                     U_bad.rho, U_bad.rho_u, U_bad.E);
+    }
+    if (watchdog.U_good.empty()) {
+        throw std::runtime_error("Non-physical initial state");
+    }
+
+    const Real t_bad = t;
+    const auto& U_good = watchdog.U_good;
+    if (U_good.size() == U.size()) {
+        std::copy(U_good.begin(), U_good.end(), U.begin());
+    } else {
+        // The MeshConfig::expand window grew since the checkpoint. Its edge
+        // cells were far field then, and so were the cells beyond them.
+        constexpr std::size_t ng = Mesh1D::num_ghosts;
+        const auto offset = static_cast<std::size_t>(watchdog.first_good - window_first_);
+        const auto good_interior = std::span<const Conservative>(U_good).subspan(ng, U_good.size() - 2 * ng);
+        const auto begin = U.begin() + static_cast<std::ptrdiff_t>(offset + ng);
+        std::fill(U.begin(), begin, good_interior.front());
+        std::copy(good_interior.begin(), good_interior.end(), begin);
+        std::fill(begin + static_cast<std::ptrdiff_t>(good_interior.size()), U.end(), good_interior.back());
+    }
+    t = watchdog.t_good;
+    step = watchdog.step_good;
+    if (watchdog.retries >= config_.time.max_retries) {
+        throw std::runtime_error(std::format("Non-physical state at t = {:.6e} persists after {} retries; "
+                                             "solution left at t = {:.6e}", t_bad, watchdog.retries, t));
+    }
+
+    if (watchdog.retries == 0 || t_bad > watchdog.t_failed) {
+        watchdog.t_failed = t_bad;
+    }
+    ++watchdog.retries;
+    watchdog.cfl_scale *= Real{0.5};
+    if (bad_cell >= 0) {
+        std::println(stderr, "Watchdog: rolled back to t = {:.6e} (step {}), retrying with CFL {}",
+                     t, step, config_.time.cfl * watchdog.cfl_scale);
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::step(Real dt) {
+    if (!(dt > Real{0})) {
+        throw std::invalid_argument(std::format("Timestep must be positive, got {}", dt));
+    }
+    const ArenaScope scope(arena_);
+    expand_window();
+
+    if (use_tiling()) {
+        advance_tiled(static_cast<Acc>(dt));
+        cell_updates_.updated += mesh_.num_cells();
+    } else if (use_active_regions()) {
+        advance_active(static_cast<Acc>(dt));
+    } else {
+        // Every RK stage is a convex combination of forward Euler steps of this size
+        const Acc step_dt = static_cast<Acc>(dt);
+        const Acc half_dt = Acc{0.5} * step_dt;
+        // The positivity guard sizes its check for forward Euler steps, which implicit steps are not
+        const bool implicit = is_implicit(time_integrator_);
+        const Acc guard_dt = implicit ? Acc{0} : step_dt;
+        split_source_step(U_, mesh_.first_interior(), mesh_.last_interior(), 0, half_dt);
+        auto rhs_func = [this, guard_dt](std::span<const Conservative> U_in, std::span<AccConservative> dU_out) {
+            // Need a mutable copy for boundary application
+            auto& U_stage = cells_.stage;
+            std::copy(U_in.begin(), U_in.end(), U_stage.begin());
+            apply_left_boundary<T>(bc_left_, U_stage, mesh_);
+            apply_right_boundary<T>(bc_right_, U_stage, mesh_);
+            compute_rhs(U_stage, dU_out, guard_dt);
+        };
+        if (implicit) {
+            auto solve_func = [this](std::span<const Conservative> U_in, Acc alpha, std::span<AccConservative> b) {
+                solve_linearized(U_in, alpha, b);
+            };
+            advance<T, Acc>(time_integrator_, U_, step_dt, rhs_func, solve_func, implicit_.history);
+        } else {
+            advance<T, Acc>(time_integrator_, U_, step_dt, rhs_func);
+        }
+        split_source_step(U_, mesh_.first_interior(), mesh_.last_interior(), 0, half_dt);
+        cell_updates_.updated += mesh_.num_cells();
+    }
 
+    // Apply boundary conditions
+    apply_boundaries();
+
+    time_ += dt;
+    ++steps_;
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::advance_to(Real t) {
+    const ArenaScope scope(arena_);
+    if (num_ranks() > 1) {
+        march_decomposed(t);
+    } else {
+        march_serial(t);
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::march_serial(Real t_final) {
+    Watchdog watchdog;
     while (time_ < t_final) {
-        // Compute stable timestep
-        Real dt = compute_dt();
+        // Compute stable timestep, checking the solution in the same pass
+        const auto scan = scan_state(U_, mesh_.first_interior(), mesh_.last_interior());
+        if (scan.first_bad >= 0) [[unlikely]] {
+            watchdog_roll_back(watchdog, U_, time_, steps_, scan.first_bad, 0);
+            implicit_.history.U_prev.clear();  // BDF2 restarts from the restored solution
+            continue;
+        }
+        watchdog_retain(watchdog, U_, time_, steps_);
+        Real dt = dt_from_speed(scan.max_speed) * watchdog.cfl_scale;
 
         // Adjust final step to hit t_final exactly
         if (time_ + dt > t_final) {
             dt = t_final - time_;
         }
 
-        // Advance solution
-        advance(time_integrator_, U_, dt, rhs_func);
+        step(dt);
+
+        // Progress output every 100 steps
+        if (verbose_ && steps_ % 100 == 0) {
+            std::println("  Step {:6d}, t = {:.6f}, dt = {:.6e}", steps_, time_, dt);
+        }
+    }
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::steady_step(Acc max_speed, Real cfl_scale, AccConservative* residual_sq) {
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+    const bool implicit = is_implicit(time_integrator_);
+    // The MUSCL-Hancock and ADER predictors are sized for one global step
+    const bool local = config_.steady.local_time_stepping && !implicit && !hancock() && !ader();
+    const Real dt = dt_from_speed(max_speed) * cfl_scale;
+    const std::span<const AccConservative> forcing = steady_.forcing;
+
+    // Local time stepping scales dU_i by dt_i / dt (>= 1), so every RK stage
+    // moves cell i with its own CFL-limited step dt_i
+    auto& dt_scale = steady_.dt_scale;
+    Acc max_scale{1};
+    if (local) {
+        dt_scale.resize(U_.size());
+        std::visit([&](const auto& eos) {
+            for (int i = first; i <= last; ++i) {
+                const auto U_i = precision_cast<Acc>(U_[static_cast<std::size_t>(i)]);
+                const Acc speed = std::abs(U_i.rho_u / U_i.rho) + eos.sound_speed(U_i);
+                dt_scale[static_cast<std::size_t>(i)] = max_speed / speed;
+            }
+        }, eos_);
+        max_scale = *std::max_element(dt_scale.begin() + first, dt_scale.begin() + last + 1);
+    }
+
+    // The positivity guard checks the largest forward Euler step of any cell
+    const Acc step_dt = static_cast<Acc>(dt);
+    const Acc guard_dt = implicit ? Acc{0} : step_dt * max_scale;
+    bool first_rhs = true;
+    auto rhs_func = [&](std::span<const Conservative> U_in, std::span<AccConservative> dU_out) {
+        auto& U_stage = cells_.stage;
+        std::copy(U_in.begin(), U_in.end(), U_stage.begin());
+        apply_left_boundary<T>(bc_left_, U_stage, mesh_);
+        apply_right_boundary<T>(bc_right_, U_stage, mesh_);
+        // The residual is summed before the FAS forcing is added
+        compute_rhs(U_stage, dU_out, W_, dW_, fluxes_, cells_, guard_dt, 0, first_rhs ? residual_sq : nullptr);
+        first_rhs = false;
+        if (!forcing.empty()) {
+            for (int i = first; i <= last; ++i) {
+                dU_out[static_cast<std::size_t>(i)] += forcing[static_cast<std::size_t>(i)];
+            }
+        }
+        if (local) {
+            for (int i = first; i <= last; ++i) {
+                dU_out[static_cast<std::size_t>(i)] *= dt_scale[static_cast<std::size_t>(i)];
+            }
+        }
+    };
+
+    if (implicit) {
+        auto solve_func = [this](std::span<const Conservative> U_in, Acc alpha, std::span<AccConservative> b) {
+            solve_linearized(U_in, alpha, b);
+        };
+        advance<T, Acc>(time_integrator_, U_, step_dt, rhs_func, solve_func, implicit_.history);
+    } else {
+        advance<T, Acc>(time_integrator_, U_, step_dt, rhs_func);
+    }
+    apply_boundaries();
+    time_ += dt;
+    ++steps_;
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::fas_cycle(Acc max_speed, Real cfl_scale, AccConservative* residual_sq) {
+    steady_step(max_speed, cfl_scale, residual_sq);
+
+    BasicSolver* coarse = steady_.coarse.get();
+    if (!coarse) {
+        return;
+    }
+    const int n_coarse = coarse->mesh_.num_cells();
+    const int first = Mesh1D::first_interior();
+    const int last = coarse->mesh_.last_interior();
+
+    // R(U) + P on this level at the smoothed solution
+    auto& rhs = steady_.rhs;
+    rhs.resize(U_.size());
+    compute_rhs(U_, rhs, W_, dW_, fluxes_, cells_, Acc{0}, 0);
+    if (!steady_.forcing.empty()) {
+        for (int i = mesh_.first_interior(); i <= mesh_.last_interior(); ++i) {
+            rhs[static_cast<std::size_t>(i)] += steady_.forcing[static_cast<std::size_t>(i)];
+        }
+    }
+
+    // Coarse problem R_c(U_c) + P_c = 0 with P_c = I(R + P) - R_c(I U), so
+    // that I U solves it exactly once this level has converged
+    restrict_average(std::span<const Conservative>(U_), std::span<Conservative>(coarse->U_), n_coarse);
+    coarse->apply_boundaries();
+    coarse->steady_.U_restricted.assign(coarse->U_.begin(), coarse->U_.end());
+    coarse->implicit_.history.U_prev.clear();
+    if (coarse->scan_state(coarse->U_, first, last).first_bad >= 0) [[unlikely]] {
+        return;
+    }
+
+    auto& coarse_rhs = coarse->steady_.rhs;
+    auto& forcing = coarse->steady_.forcing;
+    coarse_rhs.resize(coarse->U_.size());
+    coarse->compute_rhs(coarse->U_, coarse_rhs, coarse->W_, coarse->dW_, coarse->fluxes_, coarse->cells_, Acc{0}, 0);
+    forcing.resize(coarse->U_.size());
+    restrict_average(std::span<const AccConservative>(rhs), std::span<AccConservative>(forcing), n_coarse);
+    for (int i = first; i <= last; ++i) {
+        forcing[static_cast<std::size_t>(i)] -= coarse_rhs[static_cast<std::size_t>(i)];
+    }
+
+    const auto scan = coarse->scan_state(coarse->U_, first, last);
+    coarse->fas_cycle(scan.max_speed, cfl_scale, nullptr);
+
+    // A coarse level that lost positivity has nothing useful to contribute
+    if (coarse->scan_state(coarse->U_, first, last).first_bad >= 0) [[unlikely]] {
+        return;
+    }
+
+    // Correction U += P(U_c - I U), reusing the coarse RHS buffer
+    for (int i = first; i <= last; ++i) {
+        const auto k = static_cast<std::size_t>(i);
+        coarse_rhs[k] = precision_cast<Acc>(coarse->U_[k]) - precision_cast<Acc>(coarse->steady_.U_restricted[k]);
+    }
+    prolong_limited_add(std::span<const AccConservative>(coarse_rhs), std::span<Conservative>(U_), n_coarse);
+    apply_boundaries();
+}
+
+template <typename T, typename Acc>
+auto BasicSolver<T, Acc>::solve_steady() -> SteadyResult {
+    const ArenaScope scope(arena_);
+    const auto& steady = config_.steady;
+    const int first = mesh_.first_interior();
+    const int last = mesh_.last_interior();
+
+    // Chain of coarser solvers, each owning the next
+    if (steady.multigrid_levels > 1 && !steady_.coarse) {
+        // Much coarser meshes smear shocks over the whole domain and stall the cycle
+        constexpr int min_coarse_cells = 32;
+        const MeshHierarchy hierarchy(mesh_, steady.multigrid_levels, min_coarse_cells);
+        BasicSolver* level = this;
+        for (int l = 1; l < hierarchy.num_levels(); ++l) {
+            Config coarse_config = config_;
+            coarse_config.mesh.num_cells = hierarchy.level(l).num_cells();
+            coarse_config.steady.multigrid_levels = 1;
+            coarse_config.execution = ExecutionConfig{};
+            coarse_config.execution.precision = config_.execution.precision;
+            level->steady_.coarse = std::make_unique<BasicSolver>(coarse_config, arena_);
+            level = level->steady_.coarse.get();
+        }
+    }
+
+    SteadyResult result;
+    double peak_residual = 0.0;
+    Watchdog watchdog;
+    while (result.iterations < steady.max_iterations) {
+        const auto scan = scan_state(U_, first, last);
+        if (scan.first_bad >= 0) [[unlikely]] {
+            watchdog_roll_back(watchdog, U_, time_, steps_, scan.first_bad, 0);
+            implicit_.history.U_prev.clear();
+            continue;
+        }
+        watchdog_retain(watchdog, U_, time_, steps_);
+
+        AccConservative residual_sq;
+        fas_cycle(scan.max_speed, watchdog.cfl_scale, &residual_sq);
+        ++result.iterations;
 
-        // Apply boundary conditions
-        apply_boundaries();
+        // Residual of the solution the iteration started from
+        double total_sq = 0.0;
+        for (std::size_t k = 0; k < residual_sq.size(); ++k) {
+            const double dx_sq = static_cast<double>(residual_sq[k]) * static_cast<double>(mesh_.dx());
+            result.residual[k] = std::sqrt(dx_sq);
+            total_sq += dx_sq;
+        }
+        const double total = std::sqrt(total_sq);
+        peak_residual = std::max(peak_residual, total);
+        result.relative_residual = peak_residual > 0.0 ? total / peak_residual : 0.0;
+
+        if (verbose_ && steps_ % 100 == 0) {
+            std::println("  Iteration {:6d}, residual = {:.6e} (relative {:.3e})",
+                         steps_, total, result.relative_residual);
+        }
+        if (result.relative_residual <= static_cast<double>(steady.tolerance)) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+template <typename T, typename Acc>
+int BasicSolver<T, Acc>::num_ranks() const noexcept {
+    // Implicit steps solve one system over the whole domain; PCR threads it instead
+    if (is_implicit(time_integrator_)) {
+        return 1;
+    }
+    int ranks = config_.execution.threads;
+    if (config_.execution.processes > 1) {
+        ranks = config_.execution.processes;
+    } else if (ranks == 0) {
+        ranks = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    // Each subdomain must supply a full ghost layer to its neighbours
+    return std::clamp(ranks, 1, std::max(1, mesh_.num_cells() / Mesh1D::num_ghosts));
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::march_decomposed(Real t_final) {
+    const int num_ranks = this->num_ranks();
+    const Real t_start = time_;
+    const int step_start = steps_;
+
+    if (config_.execution.processes > 1) {
+        // Mailboxes and the gathered solution must be mapped before forking
+        SharedMemoryRegion mailbox_memory(sizeof(HaloMailbox<T>) * static_cast<std::size_t>(num_ranks));
+        SharedMemoryRegion gather_memory(sizeof(Conservative) * U_.size());
+        auto* mailbox_data = static_cast<HaloMailbox<T>*>(mailbox_memory.data());
+        std::uninitialized_value_construct_n(mailbox_data, num_ranks);
+        const std::span<HaloMailbox<T>> mailboxes(mailbox_data, static_cast<std::size_t>(num_ranks));
+        const std::span<Conservative> gathered(static_cast<Conservative*>(gather_memory.data()), U_.size());
+
+        run_process_ranks(num_ranks, [&](int rank) {
+            MailboxCommunicator<T> comm(mailboxes, gathered, rank);
+            march_subdomain(comm, t_start, step_start, t_final);
+        }, [mailboxes] { abort_ranks(mailboxes); });
+
+        const int first = mesh_.first_interior();
+        const int last = mesh_.last_interior();
+        std::copy(gathered.begin() + first, gathered.begin() + last + 1, U_.begin() + first);
+        std::destroy(mailboxes.begin(), mailboxes.end());
+    } else {
+        std::vector<HaloMailbox<T>> mailboxes(static_cast<std::size_t>(num_ranks));
+        run_thread_ranks(num_ranks, [&](int rank) {
+            // Threads share the address space, so ranks gather straight into U_
+            MailboxCommunicator<T> comm(mailboxes, U_, rank);
+            march_subdomain(comm, t_start, step_start, t_final);
+        }, [&mailboxes] { abort_ranks(std::span<HaloMailbox<T>>(mailboxes)); });
+    }
+
+    apply_boundaries();
+}
+
+template <typename T, typename Acc>
+template <typename Comm>
+void BasicSolver<T, Acc>::march_subdomain(Comm& comm, Real t_start, int step_start, Real t_final) {
+    static_assert(Communicator<Comm, T>);
+    constexpr int ng = Mesh1D::num_ghosts;
+    const int rank = comm.rank();
+    const int num_ranks = comm.size();
+    const int first = mesh_.first_interior();
+    const int n_cells = mesh_.num_cells();
+
+    // Owned interior cells [begin, end) in global indices
+    const int begin = first + static_cast<int>(static_cast<long long>(n_cells) * rank / num_ranks);
+    const int end = first + static_cast<int>(static_cast<long long>(n_cells) * (rank + 1) / num_ranks);
+    const int n_local = end - begin + 2 * ng;
+    const Mesh1D local_mesh{mesh_.x_face_left(begin), mesh_.x_face_left(end), end - begin};
+
+    // Allocated here so the owning rank touches the pages first, from an
+    // arena of its own when huge pages are requested
+    std::unique_ptr<Arena> rank_arena;
+    if (config_.execution.huge_pages != HugePages::None) {
+        rank_arena = std::make_unique<Arena>(arena_bytes(static_cast<std::size_t>(n_local)),
+                                             config_.execution.huge_pages);
+    }
+    const ArenaScope scope(rank_arena.get());
+    BasicConservativeArray<T> U(U_.begin() + (begin - ng), U_.begin() + (end + ng));
+    BasicConservativeArray<T> U_stage(static_cast<std::size_t>(n_local));
+    BasicPrimitiveArray<T> W(static_cast<std::size_t>(n_local));
+    BasicPrimitiveArray<T> dW(cell_slopes() ? static_cast<std::size_t>(n_local) : 0);
+    BasicConservativeArray<Acc> fluxes(static_cast<std::size_t>(n_local + 1));
+    CellWorkspace cells;
+    size_cell_workspace(cells, static_cast<std::size_t>(n_local));
+
+    // Ghosts come from a neighbour unless this is a non-periodic domain end
+    const bool from_left = (rank > 0) || std::holds_alternative<PeriodicBoundary>(bc_left_);
+    const bool from_right = (rank < num_ranks - 1) || std::holds_alternative<PeriodicBoundary>(bc_right_);
+
+    Acc step_dt{0};
+    auto rhs = [&](std::span<const Conservative> U_in, std::span<AccConservative> dU_out) {
+        std::copy(U_in.begin(), U_in.end(), U_stage.begin());
+
+        comm.exchange_halos(U_stage, from_left, from_right);
+        if (!from_left) {
+            apply_left_boundary<T>(bc_left_, U_stage, local_mesh);
+        }
+        if (!from_right) {
+            apply_right_boundary<T>(bc_right_, U_stage, local_mesh);
+        }
+
+        compute_rhs(U_stage, dU_out, W, dW, fluxes, cells, step_dt, begin - ng);
+    };
 
-        time_ += dt;
+    // A rank that fails the scan reports this instead of its wave speed, so
+    // the timestep reduction doubles as the vote to roll back
+    constexpr double unhealthy = std::numeric_limits<double>::max();
+
+    Real t = t_start;
+    int step = step_start;
+    Watchdog watchdog;
+    while (t < t_final) {
+        const auto scan = scan_state(U, ng, n_local - ng - 1);
+        const double local_speed = scan.first_bad >= 0 ? unhealthy : static_cast<double>(scan.max_speed);
+        const double max_speed = comm.allreduce_max(local_speed);
+        if (max_speed == unhealthy) [[unlikely]] {
+            // Every rank rolls back; the one that found the cell reports it
+            watchdog_roll_back(watchdog, U, t, step, scan.first_bad, begin - ng);
+            continue;
+        }
+        watchdog_retain(watchdog, U, t, step);
+        Real dt = dt_from_speed(static_cast<Acc>(max_speed)) * watchdog.cfl_scale;
+        if (t + dt > t_final) {
+            dt = t_final - t;
+        }
+
+        step_dt = static_cast<Acc>(dt);
+        split_source_step(U, ng, n_local - ng - 1, begin - ng, Acc{0.5} * step_dt);
+        advance<T, Acc>(time_integrator_, U, step_dt, rhs);
+        split_source_step(U, ng, n_local - ng - 1, begin - ng, Acc{0.5} * step_dt);
+
+        t += dt;
         ++step;
 
-        // Progress output every 100 steps
-        if (step % 100 == 0) {
-            std::println("  Step {:6d}, t = {:.6f}, dt = {:.6e}", step, time_, dt);
+        if (verbose_ && rank == 0 && step % 100 == 0) {
+            std::println("  Step {:6d}, t = {:.6f}, dt = {:.6e}", step, t, dt);
+        }
+    }
+
+    // Owned cells are disjoint, so the gather needs no synchronisation
+    comm.gather(std::span<const Conservative>(U).subspan(ng, static_cast<std::size_t>(end - begin)), begin);
+
+    if (config_.execution.rank_output) {
+        std::visit([&U, &W](const auto& eos) {
+            for (std::size_t i = 0; i < U.size(); ++i) {
+                W[i] = precision_cast<T>(eos.to_primitive(precision_cast<Acc>(U[i])));
+            }
+        }, eos_);
+        const auto path = output_dir_ / std::format("{}_rank{}.csv", config_.simulation.test_name, rank);
+        write_csv(path, local_mesh, std::span<const Conservative>(U), W, t);
+    }
+
+    if (rank == 0) {
+        time_ = t;
+        steps_ = step;
+    }
+}
+
+template <typename T, typename Acc>
+BasicPrimitiveArray<T> BasicSolver<T, Acc>::to_primitive() const {
+    BasicPrimitiveArray<T> W(U_.size());
+    std::visit([&W, this](const auto& eos) {
+        for (std::size_t i = 0; i < U_.size(); ++i) {
+            W[i] = precision_cast<T>(eos.to_primitive(precision_cast<Acc>(U_[i])));
+        }
+    }, eos_);
+    return W;
+}
+
+template <typename T, typename Acc>
+BasicConservativeVars<double> BasicSolver<T, Acc>::conserved_totals() const {
+    BasicConservativeVars<double> total;
+    for (int i = mesh_.first_interior(); i <= mesh_.last_interior(); ++i) {
+        total += precision_cast<double>(U_[static_cast<std::size_t>(i)]);
+    }
+    return total * static_cast<double>(mesh_.dx());
+}
+
+template <typename T, typename Acc>
+void BasicSolver<T, Acc>::run() {
+    const Real t_final = config_.time.final_time;
+
+    if (verbose_) {
+        std::println("Starting simulation: {}", config_.simulation.test_name);
+        std::println("  Domain: [{}, {}], Cells: {}", mesh_.xmin(), mesh_.xmax(), mesh_.num_cells());
+        if (config_.steady.enabled) {
+            std::println("  Steady state: tolerance {}, CFL: {}, local time stepping: {}", config_.steady.tolerance,
+                         config_.time.cfl, config_.steady.local_time_stepping);
+        } else {
+            std::println("  Final time: {}, CFL: {}", t_final, config_.time.cfl);
         }
+        std::println("  Order: {}, Precision: {}, Ranks: {}", order_, precision_name(), num_ranks());
+    }
+
+    const auto initial_totals = conserved_totals();
+    const int initial_steps = steps_;
+    const auto initial_updates = cell_updates_;
+
+    // Start timing
+    const auto start_time = std::chrono::high_resolution_clock::now();
+
+    SteadyResult steady;
+    if (config_.steady.enabled) {
+        steady = solve_steady();
+    } else {
+        advance_to(t_final);
+        fit_window_to_domain();
     }
 
     // End timing and compute performance metrics
     const auto end_time = std::chrono::high_resolution_clock::now();
+    if (!verbose_) {
+        return;
+    }
+
     const auto elapsed = std::chrono::duration<double>(end_time - start_time);
     const double wall_time = elapsed.count();
-    const double cells_per_sec = static_cast<double>(step) * static_cast<double>(mesh_.num_cells()) / wall_time;
-    const double steps_per_sec = static_cast<double>(step) / wall_time;
+    const int steps = steps_ - initial_steps;
+    // The window of MeshConfig::expand was stepped, not the mesh it was fitted to
+    const double cell_steps =
+        config_.mesh.expand
+            ? static_cast<double>(cell_updates_.updated + cell_updates_.skipped - initial_updates.updated -
+                                  initial_updates.skipped)
+            : static_cast<double>(steps) * static_cast<double>(mesh_.num_cells());
+    const double cells_per_sec = cell_steps / wall_time;
+    const double steps_per_sec = static_cast<double>(steps) / wall_time;
 
-    std::println("Simulation complete: {} steps, final time = {:.6f}", step, time_);
+    // Relative change of the conserved totals (boundary fluxes included)
+    const auto final_totals = conserved_totals();
+    auto relative_change = [](double initial, double final) {
+        return (final - initial) / std::max(std::abs(initial), 1.0e-300);
+    };
+
+    std::println("Simulation complete: {} steps, final time = {:.6f}", steps, time_);
+    if (config_.steady.enabled) {
+        std::println("Steady state {} after {} iterations: residual dropped to {:.3e} of its peak",
+                     steady.converged ? "converged" : "NOT converged", steady.iterations, steady.relative_residual);
+    }
     std::println("Performance:");
     std::println("  Wall time:    {:.4f} s", wall_time);
     std::println("  Steps/sec:    {:.2f}", steps_per_sec);
     std::println("  Mcells/sec:   {:.2f}", cells_per_sec / 1.0e6);
+    std::println("Conserved totals (relative change):");
+    std::println("  Mass:         {:.3e}", relative_change(initial_totals.rho, final_totals.rho));
+    std::println("  Energy:       {:.3e}", relative_change(initial_totals.E, final_totals.E));
+    if (config_.numerics.positivity && order_ >= 2) {
+        const auto corrections = positivity_corrections();
+        std::println("Positivity guard:");
+        std::println("  Limited states: {}", corrections.limited_states);
+        std::println("  Fallback faces: {}", corrections.fallback_faces);
+    }
+    if (config_.mesh.expand) {
+        std::println("Expanding window:");
+        std::println("  Peak cells:   {} of {} in the domain, {} extensions", window_stats_.peak_cells,
+                     config_.mesh.num_cells, window_stats_.extensions);
+    }
+    if (use_active_regions()) {
+        const auto updates = cell_update_counts();
+        const auto total = updates.updated + updates.skipped;
+        std::println("Active regions:");
+        std::println("  Skipped:      {:.1f}% of cell updates",
+                     total > 0 ? 100.0 * static_cast<double>(updates.skipped) / static_cast<double>(total) : 0.0);
+    }
+    if (arena_ != nullptr) {
+        const auto stats = arena_->stats();
+        constexpr double mib = 1024.0 * 1024.0;
+        std::println("Arena:");
+        std::println("  Peak:         {:.2f} of {:.2f} MiB", static_cast<double>(stats.peak) / mib,
+                     static_cast<double>(stats.capacity) / mib);
+        std::println("  Allocations:  {} ({:.2f} MiB from the heap after the arena filled)", stats.allocations,
+                     static_cast<double>(stats.overflow_bytes) / mib);
+        constexpr const char* page_names[] = {"base", "transparent huge", "explicit huge"};
+        const auto usage = arena_->page_usage();
+        std::println("  Pages:        {} ({:.2f} of {:.2f} MiB resident in huge pages)",
+                     page_names[static_cast<int>(stats.pages)], static_cast<double>(usage.huge_page_bytes) / mib,
+                     static_cast<double>(usage.resident_bytes) / mib);
+    }
 }
 
+// Precision modes available at runtime
+template class BasicSolver<double>;
+template class BasicSolver<float>;
+template class BasicSolver<float, double>;
+
 }  // namespace euler1d
@@ -0,0 +1,176 @@
+/**
+ * @file test_arena.cpp
+ * @brief Tests for the arena allocator and solvers drawing from it
+ */
+
+#include <gtest/gtest.h>
+#include "euler1d/memory/arena.hpp"
+#include "euler1d/solver/solver.hpp"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+using namespace euler1d;
+
+namespace {
+
+bool is_aligned(const void* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % Arena::alignment == 0;
+}
+
+Config sod_config(int num_cells) {
+    Config config;
+    config.mesh = MeshConfig{0.0, 1.0, num_cells};
+    config.time.final_time = 0.1;
+    config.time.cfl = 0.5;
+    config.numerics.order = 2;
+    config.initial_condition.type = InitialConditionType::PiecewiseConstant;
+    config.initial_condition.regions = {
+        Region{0.0, 0.5, 1.0, 0.0, 1.0, {}},
+        Region{0.5, 1.0, 0.125, 0.0, 0.1, {}}
+    };
+    return config;
+}
+
+}  // namespace
+
+TEST(ArenaTest, BumpAllocationIsAlignedAndReleasedInReverseOrder) {
+    Arena arena(1 << 20);
+    const auto capacity = arena.stats().capacity;
+    EXPECT_GE(capacity, std::size_t{1} << 20);
+
+    void* a = arena.allocate(10);
+    void* b = arena.allocate(100);
+    EXPECT_TRUE(is_aligned(a));
+    EXPECT_TRUE(is_aligned(b));
+    EXPECT_EQ(arena.stats().in_use, 64u + 128u);
+
+    // Freeing the most recent block rolls the offset back; the next one reuses it
+    arena.deallocate(b, 100);
+    EXPECT_EQ(arena.stats().in_use, 64u);
+    EXPECT_EQ(arena.allocate(100), b);
+
+    // Blocks that do not fit come from the heap, still aligned
+    void* big = arena.allocate(capacity);
+    EXPECT_TRUE(is_aligned(big));
+    EXPECT_EQ(arena.stats().overflow_bytes, capacity);
+    arena.deallocate(big, capacity);
+
+    EXPECT_THROW(arena.reset(), std::logic_error);
+    arena.deallocate(b, 100);
+    arena.deallocate(a, 10);
+    arena.reset();
+
+    const auto stats = arena.stats();
+    EXPECT_EQ(stats.in_use, 0u);
+    EXPECT_EQ(stats.peak, 64u + 128u);
+    EXPECT_EQ(stats.live_allocations, 0u);
+    EXPECT_EQ(stats.allocations, 4);
+}
+
+TEST(ArenaTest, ContainersBindToTheCurrentArena) {
+    Arena arena(1 << 20);
+    ArenaVector<double> outside(8);
+    EXPECT_EQ(outside.get_allocator().arena(), nullptr);
+    EXPECT_TRUE(is_aligned(outside.data()));
+
+    {
+        const ArenaScope scope(&arena);
+        ArenaVector<double> inside(8);
+        EXPECT_EQ(inside.get_allocator().arena(), &arena);
+
+        // Copies bind to the current arena, moves keep the source's
+        ArenaVector<double> copy(outside);
+        EXPECT_EQ(copy.get_allocator().arena(), &arena);
+        ArenaVector<double> moved(std::move(outside));
+        EXPECT_EQ(moved.get_allocator().arena(), nullptr);
+
+        const ArenaScope heap(nullptr);
+        EXPECT_EQ(Arena::current(), nullptr);
+    }
+    EXPECT_EQ(Arena::current(), nullptr);
+    EXPECT_EQ(arena.stats().live_allocations, 0u);
+}
+
+TEST(ArenaTest, EnsembleMembersReuseTheArena) {
+    const auto config = sod_config(200);
+    Solver reference(config);
+    reference.advance_to(config.time.final_time);
+
+    Arena arena(16 << 20);
+    std::size_t first_peak = 0;
+    for (int member = 0; member < 3; ++member) {
+        {
+            Solver solver(config, &arena);
+            EXPECT_EQ(solver.arena(), &arena);
+            solver.advance_to(config.time.final_time);
+            for (std::size_t i = 0; i < solver.interior().size(); ++i) {
+                EXPECT_EQ(solver.interior()[i].rho, reference.interior()[i].rho) << "cell " << i;
+            }
+            EXPECT_TRUE(is_aligned(solver.solution().data()));
+        }
+        arena.reset();
+        const auto stats = arena.stats();
+        EXPECT_EQ(stats.overflow_bytes, 0u);
+        if (member == 0) {
+            first_peak = stats.peak;
+            EXPECT_GT(first_peak, 0u);
+        }
+        EXPECT_EQ(stats.peak, first_peak);
+    }
+}
+
+TEST(ArenaTest, PagePolicyIsReportedWithResidentMemory) {
+    Arena base(4 << 20, HugePages::None);
+    EXPECT_EQ(base.stats().pages, HugePages::None);
+
+    // Explicit pages need a hugetlbfs pool; without one the arena falls back
+    Arena huge(4 << 20, HugePages::Explicit);
+    EXPECT_NE(huge.stats().pages, HugePages::None);
+
+#ifdef __linux__
+    void* p = base.allocate(1 << 20);
+    std::memset(p, 1, 1 << 20);
+    const auto usage = base.page_usage();
+    EXPECT_GE(usage.resident_bytes, std::size_t{1} << 20);
+    EXPECT_LE(usage.huge_page_bytes, usage.resident_bytes);
+    base.deallocate(p, 1 << 20);
+#endif
+}
+
+TEST(ArenaTest, FirstTouchLeavesEarlierBlocksIntact) {
+    Arena arena(64 << 20);
+    auto* before = static_cast<unsigned char*>(arena.allocate(4096));
+    std::memset(before, 0xAB, 4096);
+
+    arena.set_first_touch(4);
+    constexpr std::size_t bytes = std::size_t{32} << 20;
+    auto* block = static_cast<unsigned char*>(arena.allocate(bytes));
+    EXPECT_TRUE(is_aligned(block));
+    EXPECT_EQ(before[4095], 0xAB);
+    EXPECT_EQ(block[0], 0);
+    EXPECT_EQ(block[bytes - 1], 0);
+
+    arena.deallocate(block, bytes);
+    arena.deallocate(before, 4096);
+}
+
+TEST(ArenaTest, SolverPlacementOptionsKeepResults) {
+    const auto config = sod_config(400);
+    Solver reference(config);
+    reference.advance_to(config.time.final_time);
+    EXPECT_EQ(reference.arena(), nullptr);
+
+    auto placed = config;
+    placed.execution.threads = 4;
+    placed.execution.huge_pages = HugePages::Transparent;
+    placed.execution.first_touch = true;
+    Solver solver(placed);
+    ASSERT_NE(solver.arena(), nullptr);
+    solver.advance_to(config.time.final_time);
+
+    for (std::size_t i = 0; i < solver.interior().size(); ++i) {
+        EXPECT_EQ(solver.interior()[i].rho, reference.interior()[i].rho) << "cell " << i;
+    }
+    EXPECT_EQ(solver.arena()->stats().overflow_bytes, 0u);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test_block_tridiagonal.cpp
+ * @brief Tests for the block-tridiagonal solvers
+ */
+
+#include <gtest/gtest.h>
+#include "euler1d/linear/block_tridiagonal.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace euler1d;
+
+namespace {
+
+using Matrix = BasicBlockTridiagonal<double, 3>;
+using Vector = BasicBlockVector<double, 3>;
+
+/// Random block diagonally dominant system of n block rows
+Matrix make_system(std::size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix A;
+    A.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                A.lower[i][r][c] = (i > 0) ? dist(gen) : 0.0;
+                A.upper[i][r][c] = (i + 1 < n) ? dist(gen) : 0.0;
+                A.diag[i][r][c] = dist(gen) + ((r == c) ? 10.0 : 0.0);
+            }
+        }
+    }
+    return A;
+}
+
+std::vector<Vector> make_rhs(std::size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<Vector> b(n);
+    for (auto& b_i : b) {
+        b_i = {dist(gen), dist(gen), dist(gen)};
+    }
+    return b;
+}
+
+/// max |A x - b|
+double residual(const Matrix& A, const std::vector<Vector>& x, const std::vector<Vector>& b) {
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < A.size(); ++i) {
+        auto Ax = block_multiply(A.diag[i], x[i]);
+        if (i > 0) {
+            const auto Lx = block_multiply(A.lower[i], x[i - 1]);
+            for (std::size_t r = 0; r < 3; ++r) Ax[r] += Lx[r];
+        }
+        if (i + 1 < A.size()) {
+            const auto Ux = block_multiply(A.upper[i], x[i + 1]);
+            for (std::size_t r = 0; r < 3; ++r) Ax[r] += Ux[r];
+        }
+        for (std::size_t r = 0; r < 3; ++r) {
+            max_error = std::max(max_error, std::abs(Ax[r] - b[i][r]));
+        }
+    }
+    return max_error;
+}
+
+}  // namespace
+
+TEST(BlockTridiagonalTest, BlockInverse) {
+    // Needs a row swap: the leading entry is zero
+    const BasicBlock<double, 3> A{{{0.0, 2.0, 1.0}, {1.0, 1.0, 0.0}, {3.0, 0.0, 4.0}}};
+    const auto I = block_multiply(A, block_inverse(A));
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(I[r][c], (r == c) ? 1.0 : 0.0, 1e-14);
+        }
+    }
+}
+
+TEST(BlockTridiagonalTest, ThomasSolvesSystem) {
+    for (const std::size_t n : {1u, 2u, 37u}) {
+        const Matrix A = make_system(n, 7);
+        const auto b = make_rhs(n, 11);
+        Matrix work = A;
+        auto x = b;
+        solve_block_thomas(work, std::span(x));
+        EXPECT_LT(residual(A, x, b), 1e-13) << "n = " << n;
+    }
+}
+
+TEST(BlockTridiagonalTest, CyclicReductionMatchesThomas) {
+    const std::size_t n = 37;  // Not a power of two
+    const Matrix A = make_system(n, 3);
+    const auto b = make_rhs(n, 5);
+
+    Matrix work = A;
+    auto x_thomas = b;
+    solve_block_thomas(work, std::span(x_thomas));
+
+    for (const int threads : {1, 3}) {
+        work = A;
+        auto x = b;
+        solve_block_pcr(work, std::span(x), threads);
+        EXPECT_LT(residual(A, x, b), 1e-13) << threads << " threads";
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t r = 0; r < 3; ++r) {
+                EXPECT_NEAR(x[i][r], x_thomas[i][r], 1e-13) << "row " << i;
+            }
+        }
+    }
+}
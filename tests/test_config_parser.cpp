@@ -90,3 +90,46 @@ TEST_F(ConfigParserTest, AllTestCasesParseSuccessfully) {
 TEST_F(ConfigParserTest, InvalidFileThrows) {
     EXPECT_THROW(parse_config("nonexistent.toml"), ConfigError);
 }
+
+TEST_F(ConfigParserTest, ParsePrecision) {
+    EXPECT_EQ(parse_precision("double"), Precision::Double);
+    EXPECT_EQ(parse_precision("FP32"), Precision::Float);
+    EXPECT_EQ(parse_precision("mixed"), Precision::Mixed);
+    EXPECT_THROW(parse_precision("half"), ConfigError);
+}
+
+TEST_F(ConfigParserTest, ParseSlopes) {
+    EXPECT_EQ(parse_slopes("cell"), Slopes::Cell);
+    EXPECT_EQ(parse_slopes("Per_Face"), Slopes::Face);
+    EXPECT_THROW(parse_slopes("node"), ConfigError);
+}
+
+TEST_F(ConfigParserTest, ParseFluxScheme) {
+    EXPECT_EQ(parse_flux_scheme("HLLC"), FluxScheme::HLLC);
+    EXPECT_EQ(parse_flux_scheme("steger_warming"), FluxScheme::StegerWarming);
+    EXPECT_EQ(parse_flux_scheme("vanleer"), FluxScheme::VanLeer);
+    EXPECT_EQ(parse_flux_scheme("AUSM+"), FluxScheme::AUSMPlus);
+    EXPECT_EQ(parse_flux_scheme("ausm_plus_up"), FluxScheme::AUSMPlusUp);
+    EXPECT_EQ(parse_flux_scheme("Roe"), FluxScheme::Roe);
+    EXPECT_EQ(parse_flux_scheme("hlle"), FluxScheme::HLLE);
+    EXPECT_EQ(parse_flux_scheme("KT"), FluxScheme::KurganovTadmor);
+    EXPECT_THROW(parse_flux_scheme("osher"), ConfigError);
+}
+
+TEST_F(ConfigParserTest, ParseHugePages) {
+    EXPECT_EQ(parse_huge_pages("none"), HugePages::None);
+    EXPECT_EQ(parse_huge_pages("THP"), HugePages::Transparent);
+    EXPECT_EQ(parse_huge_pages("hugetlb"), HugePages::Explicit);
+    EXPECT_THROW(parse_huge_pages("1gb"), ConfigError);
+}
+
+TEST_F(ConfigParserTest, ParseSourceOptions) {
+    EXPECT_EQ(parse_source_type("none"), SourceType::None);
+    EXPECT_EQ(parse_source_type("Nozzle"), SourceType::Geometric);
+    EXPECT_EQ(parse_source_type("gravity"), SourceType::Gravity);
+    EXPECT_EQ(parse_source_type("arrhenius"), SourceType::Reaction);
+    EXPECT_THROW(parse_source_type("magnetic"), ConfigError);
+    EXPECT_EQ(parse_source_coupling("explicit"), SourceCoupling::Explicit);
+    EXPECT_EQ(parse_source_coupling("STRANG"), SourceCoupling::Strang);
+    EXPECT_THROW(parse_source_coupling("lie"), ConfigError);
+}
@@ -89,3 +89,39 @@ TEST_F(IdealGasTest, EosVariantWorks) {
     Real p = pressure(eos_var, U);
     EXPECT_NEAR(p, 1.0, 1e-12);
 }
+
+TEST_F(IdealGasTest, PassiveScalarsAreCarriedAsPartialDensities) {
+    const BasicPrimitiveVars<Real, 5> W_orig{2.0, 3.0, 1.5, {0.25, 0.75}};
+
+    const auto U = eos.to_conservative(W_orig);
+    EXPECT_DOUBLE_EQ(U.rho_phi[0], 0.5);
+    EXPECT_DOUBLE_EQ(U.rho_phi[1], 1.5);
+    EXPECT_NEAR(eos.pressure(U), 1.5, 1e-12);  // Scalars do not enter the pressure
+
+    const auto W = eos.to_primitive(U);
+    EXPECT_NEAR(W.phi[0], 0.25, 1e-15);
+    EXPECT_NEAR(W.phi[1], 0.75, 1e-15);
+
+    // Advected with the mass flux: F_k = rho * u * phi_k
+    const auto F = eos.flux(U);
+    EXPECT_NEAR(F.rho_phi[0], 6.0 * 0.25, 1e-12);
+    EXPECT_NEAR(F.rho_phi[1], 6.0 * 0.75, 1e-12);
+}
+
+TEST_F(IdealGasTest, FluxJacobianMatchesFiniteDifferences) {
+    using State = BasicConservativeVars<Real, 5>;
+    const State U = eos.to_conservative(BasicPrimitiveVars<Real, 5>{0.8, -0.6, 1.7, {0.3, 0.9}});
+    const auto A = eos.flux_jacobian(U);
+
+    const Real h = 1e-6;
+    for (std::size_t c = 0; c < U.size(); ++c) {
+        State U_plus = U;
+        State U_minus = U;
+        U_plus[c] += h;
+        U_minus[c] -= h;
+        const State dF = (eos.flux(U_plus) - eos.flux(U_minus)) / (Real{2} * h);
+        for (std::size_t r = 0; r < U.size(); ++r) {
+            EXPECT_NEAR(A[r][c], dF[r], 1e-7) << "row " << r << ", column " << c;
+        }
+    }
+}
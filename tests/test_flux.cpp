@@ -6,7 +6,10 @@
 #include <gtest/gtest.h>
 #include "euler1d/flux/flux.hpp"
 #include "euler1d/eos/eos.hpp"
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 using namespace euler1d;
 
@@ -90,7 +93,9 @@ TEST_F(FluxTest, AllFluxesProduceValidOutput) {
     auto U_R = make_state(0.125, 0.0, 0.1);
 
     std::vector<FluxVariant> fluxes = {
-        LLFFlux{}, RusanovFlux{}, HLLFlux{}, HLLCFlux{}
+        LLFFlux{}, RusanovFlux{}, HLLFlux{}, HLLCFlux{},
+        StegerWarmingFlux{}, VanLeerFlux{}, AUSMPlusFlux{}, AUSMPlusUpFlux{}, RoeFlux{}, HLLEFlux{},
+        KurganovTadmorFlux{}
     };
 
     for (const auto& flux : fluxes) {
@@ -100,3 +105,230 @@ TEST_F(FluxTest, AllFluxesProduceValidOutput) {
         EXPECT_TRUE(std::isfinite(F.E));
     }
 }
+
+TEST_F(FluxTest, PassiveScalarsFollowMassFlux) {
+    // Contact moving right with two species
+    const BasicPrimitiveVars<Real, 5> W_L{1.0, 0.5, 1.0, {0.8, 0.2}};
+    const BasicPrimitiveVars<Real, 5> W_R{0.5, 0.5, 1.0, {0.1, 0.9}};
+    const auto U_L = eos.to_conservative(W_L);
+    const auto U_R = eos.to_conservative(W_R);
+
+    std::vector<FluxVariant> fluxes = {
+        LLFFlux{}, RusanovFlux{}, HLLFlux{}, HLLCFlux{}, MoversLEFlux{},
+        StegerWarmingFlux{}, VanLeerFlux{}, AUSMPlusFlux{}, AUSMPlusUpFlux{}, RoeFlux{}, HLLEFlux{},
+        KurganovTadmorFlux{}
+    };
+
+    // The Euler components do not see the scalars
+    for (const auto& flux : fluxes) {
+        const auto F = compute_flux(flux, U_L, U_R, eos);
+        const auto F_euler = compute_flux(flux, make_state(1.0, 0.5, 1.0), make_state(0.5, 0.5, 1.0), eos);
+        EXPECT_DOUBLE_EQ(F.rho, F_euler.rho);
+        EXPECT_DOUBLE_EQ(F.rho_u, F_euler.rho_u);
+        EXPECT_DOUBLE_EQ(F.E, F_euler.E);
+    }
+
+    // HLLC resolves the contact: scalars are carried with the upwind mass fractions
+    const auto F = HLLCFlux{}(U_L, U_R, eos);
+    EXPECT_NEAR(F.rho_phi[0], 0.8 * F.rho, 1e-12);
+    EXPECT_NEAR(F.rho_phi[1], 0.2 * F.rho, 1e-12);
+}
+
+TEST_F(FluxTest, CellStatesMatchConservativeStates) {
+    // Shock-tube-like left/right pairs, including a sonic and a reversed flow
+    const std::vector<ConservativeVars> U = {
+        make_state(1.0, 0.75, 1.0), make_state(0.125, 0.0, 0.1),
+        make_state(1.0, -2.0, 0.4), make_state(5.99924, 19.5975, 460.894),
+        make_state(0.5, 1.2, 0.3),
+    };
+
+    BasicCellCache<Real> cells;
+    cells.resize(U.size());
+    cells.fill(std::span<const ConservativeVars>(U), eos);
+
+    std::vector<FluxVariant> fluxes = {
+        LLFFlux{}, RusanovFlux{}, HLLFlux{}, HLLCFlux{}, MoversLEFlux{},
+        StegerWarmingFlux{}, VanLeerFlux{}, AUSMPlusFlux{}, AUSMPlusUpFlux{}, RoeFlux{}, HLLEFlux{},
+        KurganovTadmorFlux{}
+    };
+
+    for (const auto& flux : fluxes) {
+        for (std::size_t i = 0; i + 1 < U.size(); ++i) {
+            const auto F_ref = compute_flux(flux, U[i], U[i + 1], eos);
+            const auto F = compute_flux(flux, cells(i, U[i]), cells(i + 1, U[i + 1]), eos);
+            EXPECT_NEAR(F.rho, F_ref.rho, 1e-12 * (1.0 + std::abs(F_ref.rho)));
+            EXPECT_NEAR(F.rho_u, F_ref.rho_u, 1e-12 * (1.0 + std::abs(F_ref.rho_u)));
+            EXPECT_NEAR(F.E, F_ref.E, 1e-12 * (1.0 + std::abs(F_ref.E)));
+        }
+    }
+}
+
+TEST_F(FluxTest, SplitFluxesSumToPhysicalFlux) {
+    // Subsonic and supersonic states in both directions, with a passive scalar
+    for (const Real u : {-3.0, -1.0, -0.2, 0.0, 0.5, 1.1, 4.0}) {
+        const auto U = eos.to_conservative(BasicPrimitiveVars<Real, 4>{0.7, u, 1.3, {0.25}});
+        const auto K = make_cell_state(U, eos);
+        const auto F = eos.flux(U);
+        for (const auto& [F_plus, F_minus] : {std::pair{StegerWarmingFlux{}.plus(K, eos), StegerWarmingFlux{}.minus(K, eos)},
+                                              std::pair{VanLeerFlux{}.plus(K, eos), VanLeerFlux{}.minus(K, eos)}}) {
+            for (std::size_t k = 0; k < F.size(); ++k) {
+                EXPECT_NEAR(F_plus[k] + F_minus[k], F[k], 1e-12 * (1.0 + std::abs(F[k]))) << "u = " << u;
+            }
+            // Upwind: the mass flux of F+ is never negative, that of F- never positive
+            EXPECT_GE(F_plus.rho, 0.0);
+            EXPECT_LE(F_minus.rho, 0.0);
+        }
+    }
+}
+
+TEST_F(FluxTest, SplitFluxCacheMatchesFaceFlux) {
+    const std::vector<ConservativeVars> U = {
+        make_state(1.0, 0.75, 1.0), make_state(0.125, 0.0, 0.1),
+        make_state(1.0, -2.0, 0.4), make_state(5.99924, 19.5975, 460.894),
+        make_state(0.5, 1.2, 0.3),
+    };
+
+    BasicSplitFluxCache<Real> split;
+    split.resize(U.size());
+    for (const auto& flux : {FluxVariant{StegerWarmingFlux{}}, FluxVariant{VanLeerFlux{}}}) {
+        std::visit([&](const auto& f) {
+            if constexpr (VectorSplitFlux<std::decay_t<decltype(f)>>) {
+                split.fill(std::span<const ConservativeVars>(U), eos, f);
+            }
+        }, flux);
+        for (std::size_t i = 0; i + 1 < U.size(); ++i) {
+            const auto F_ref = compute_flux(flux, U[i], U[i + 1], eos);
+            const auto F = split(i);
+            EXPECT_NEAR(F.rho, F_ref.rho, 1e-12 * (1.0 + std::abs(F_ref.rho)));
+            EXPECT_NEAR(F.rho_u, F_ref.rho_u, 1e-12 * (1.0 + std::abs(F_ref.rho_u)));
+            EXPECT_NEAR(F.E, F_ref.E, 1e-12 * (1.0 + std::abs(F_ref.E)));
+        }
+    }
+}
+
+TEST_F(FluxTest, AUSMPlusConsistencyAndStationaryContact) {
+    for (const Real u : {-2.0, -0.3, 0.0, 0.6, 1.5}) {
+        const auto U = make_state(0.8, u, 1.1);
+        const auto F_phys = eos.flux(U);
+        for (const auto& flux : {FluxVariant{AUSMPlusFlux{}}, FluxVariant{AUSMPlusUpFlux{}}}) {
+            const auto F = compute_flux(flux, U, U, eos);
+            EXPECT_NEAR(F.rho, F_phys.rho, 1e-12);
+            EXPECT_NEAR(F.rho_u, F_phys.rho_u, 1e-12);
+            EXPECT_NEAR(F.E, F_phys.E, 1e-12);
+        }
+    }
+
+    // A stationary contact has no mass flux and the common pressure
+    const auto F = AUSMPlusFlux{}(make_state(1.0, 0.0, 1.0), make_state(0.1, 0.0, 1.0), eos);
+    EXPECT_NEAR(F.rho, 0.0, 1e-14);
+    EXPECT_NEAR(F.rho_u, 1.0, 1e-14);
+    EXPECT_NEAR(F.E, 0.0, 1e-14);
+}
+
+TEST_F(FluxTest, RoeAverageCacheMatchesFaceFlux) {
+    const std::vector<ConservativeVars> U = {
+        make_state(1.0, 0.75, 1.0), make_state(0.125, 0.0, 0.1),
+        make_state(1.0, -2.0, 0.4), make_state(5.99924, 19.5975, 460.894),
+        make_state(0.5, 1.2, 0.3),
+    };
+
+    BasicCellCache<Real> cells;
+    cells.resize(U.size());
+    cells.fill(std::span<const ConservativeVars>(U), eos);
+    BasicRoeAverageCache<Real> roe;
+    roe.resize(U.size());
+    roe.fill(std::span<const ConservativeVars>(U), cells, eos);
+
+    for (std::size_t i = 0; i + 1 < U.size(); ++i) {
+        const auto L = cells(i, U[i]);
+        const auto R = cells(i + 1, U[i + 1]);
+        const auto avg = make_roe_average(L, R, eos);
+        EXPECT_NEAR(roe(i).u, avg.u, 1e-12 * (1.0 + std::abs(avg.u)));
+        EXPECT_NEAR(roe(i).H, avg.H, 1e-12 * avg.H);
+        EXPECT_NEAR(roe(i).c, avg.c, 1e-12 * avg.c);
+        for (const auto& [F, F_ref] : {std::pair{RoeFlux{}(L, R, roe(i), eos), RoeFlux{}(U[i], U[i + 1], eos)},
+                                       std::pair{HLLEFlux{}(L, R, roe(i), eos), HLLEFlux{}(U[i], U[i + 1], eos)}}) {
+            EXPECT_NEAR(F.rho, F_ref.rho, 1e-12 * (1.0 + std::abs(F_ref.rho)));
+            EXPECT_NEAR(F.rho_u, F_ref.rho_u, 1e-12 * (1.0 + std::abs(F_ref.rho_u)));
+            EXPECT_NEAR(F.E, F_ref.E, 1e-12 * (1.0 + std::abs(F_ref.E)));
+        }
+    }
+}
+
+TEST_F(FluxTest, RoeResolvesStationaryContact) {
+    // A stationary contact is an exact solution: no mass flux, the common pressure
+    const auto F = RoeFlux{}(make_state(1.0, 0.0, 1.0), make_state(0.1, 0.0, 1.0), eos);
+    EXPECT_NEAR(F.rho, 0.0, 1e-12);
+    EXPECT_NEAR(F.rho_u, 1.0, 1e-12);
+    EXPECT_NEAR(F.E, 0.0, 1e-12);
+
+    // HLLE smears it
+    const auto F_hlle = HLLEFlux{}(make_state(1.0, 0.0, 1.0), make_state(0.1, 0.0, 1.0), eos);
+    EXPECT_GT(F_hlle.rho, 1e-3);
+}
+
+TEST_F(FluxTest, HLLUpwindsSupersonicFacesWithoutBranches) {
+    // Subsonic face: the intermediate-state formula with the Davis speeds
+    const auto U_L = make_state(1.0, 0.0, 1.0);
+    const auto U_R = make_state(0.125, 0.0, 0.1);
+    const auto F_hll = HLLFlux{}(U_L, U_R, eos);
+    const Real c_L = eos.sound_speed(1.0, 1.0);
+    const Real c_R = eos.sound_speed(0.125, 0.1);
+    const Real S_L = std::min(-c_L, -c_R);
+    const Real S_R = std::max(c_L, c_R);
+    const auto F_ref = (S_R * eos.flux(U_L) - S_L * eos.flux(U_R) + S_L * S_R * (U_R - U_L)) / (S_R - S_L);
+    EXPECT_NEAR(F_hll.rho, F_ref.rho, 1e-12);
+    EXPECT_NEAR(F_hll.rho_u, F_ref.rho_u, 1e-12);
+    EXPECT_NEAR(F_hll.E, F_ref.E, 1e-12);
+
+    // The central-upwind flux is the same formula
+    const auto F_kt = KurganovTadmorFlux{}(U_L, U_R, eos);
+    EXPECT_EQ(F_kt.rho, F_hll.rho);
+    EXPECT_EQ(F_kt.rho_u, F_hll.rho_u);
+    EXPECT_EQ(F_kt.E, F_hll.E);
+
+    // Supersonic either way: the clamped speed is 0 and the flux is the upwind physical flux
+    const auto V_L = make_state(1.0, 3.0, 1.0);
+    const auto V_R = make_state(0.8, 2.5, 0.9);
+    const auto V_L_mirror = make_state(0.8, -2.5, 0.9);
+    const auto V_R_mirror = make_state(1.0, -3.0, 1.0);
+    for (const auto& [F, F_phys] : {std::pair{HLLFlux{}(V_L, V_R, eos), eos.flux(V_L)},
+                                    std::pair{HLLFlux{}(V_L_mirror, V_R_mirror, eos), eos.flux(V_R_mirror)}}) {
+        EXPECT_NEAR(F.rho, F_phys.rho, 1e-12);
+        EXPECT_NEAR(F.rho_u, F_phys.rho_u, 1e-12);
+        EXPECT_NEAR(F.E, F_phys.E, 1e-12);
+    }
+}
+
+TEST_F(FluxTest, FaceSelectionFlagsJumpsAndCompactsFaces) {
+    // A 30% density step between cells 6 and 7, and a 5% pressure wobble at face 12
+    std::vector<double> rho(16, 1.0);
+    std::vector<double> p(16, 1.0);
+    for (std::size_t i = 7; i < rho.size(); ++i) rho[i] = 1.3;
+    p[13] = 1.05;
+
+    FaceSelection faces;
+    faces.resize(rho.size());
+    const auto rho_at = [&](int i) { return rho[static_cast<std::size_t>(i)]; };
+    const auto p_at = [&](int i) { return p[static_cast<std::size_t>(i)]; };
+    faces.classify(2, 12, rho_at, p_at, 0.1);
+
+    // Face 6 trips the sensor and is widened to faces 5 and 7
+    ASSERT_EQ(faces.num_sharp, 3u);
+    EXPECT_EQ(faces.sharp[0], 5);
+    EXPECT_EQ(faces.sharp[1], 6);
+    EXPECT_EQ(faces.sharp[2], 7);
+    ASSERT_EQ(faces.num_smooth, 8u);
+    const int smooth[] = {2, 3, 4, 8, 9, 10, 11, 12};
+    for (std::size_t k = 0; k < faces.num_smooth; ++k) EXPECT_EQ(faces.smooth[k], smooth[k]);
+
+    // A lower threshold flags the wobble as well, and 1/rho flags the same faces as rho
+    const auto inv_rho_at = [&](int i) { return 1.0 / rho[static_cast<std::size_t>(i)]; };
+    faces.classify(2, 12, inv_rho_at, p_at, 0.01);
+    ASSERT_EQ(faces.num_sharp, 5u);
+    EXPECT_EQ(faces.sharp[2], 7);
+    EXPECT_EQ(faces.sharp[3], 11);
+    EXPECT_EQ(faces.sharp[4], 12);
+    EXPECT_EQ(faces.num_smooth, 6u);
+}
+
@@ -24,8 +24,8 @@ protected:
 TEST_F(InitialConditionTest, PiecewiseConstantTwoRegions) {
     PiecewiseConstantIC ic;
     ic.regions = {
-        Region{0.0, 0.5, 1.0, 0.0, 1.0},    // Left half
-        Region{0.5, 1.0, 0.125, 0.0, 0.1}   // Right half
+        Region{0.0, 0.5, 1.0, 0.0, 1.0, {}},    // Left half
+        Region{0.5, 1.0, 0.125, 0.0, 0.1, {}}   // Right half
     };
 
     ic.apply(U, mesh, eos);
@@ -71,7 +71,7 @@ TEST_F(InitialConditionTest, CreateFromConfig) {
     InitialConditionConfig config;
     config.type = InitialConditionType::PiecewiseConstant;
     config.regions = {
-        Region{0.0, 1.0, 1.0, 0.0, 1.0}
+        Region{0.0, 1.0, 1.0, 0.0, 1.0, {}}
     };
 
     auto ic = create_initial_condition(config);
@@ -0,0 +1,86 @@
+/**
+ * @file test_mesh_hierarchy.cpp
+ * @brief Tests for the mesh hierarchy and its transfer kernels
+ */
+
+#include <gtest/gtest.h>
+#include "euler1d/mesh/mesh_hierarchy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace euler1d;
+
+namespace {
+
+using State = BasicConservativeVars<double, 3>;
+
+/// Array of n interior cells plus ghosts
+std::vector<State> make_array(int n) {
+    return std::vector<State>(static_cast<std::size_t>(n + 2 * Mesh1D::num_ghosts));
+}
+
+}  // namespace
+
+TEST(MeshHierarchyTest, HalvesUntilOddOrTooSmall) {
+    const MeshHierarchy hierarchy(Mesh1D{0.0, 2.0, 96}, 10);
+    ASSERT_EQ(hierarchy.num_levels(), 5);  // 96, 48, 24, 12, 6 (3 < 4 cells)
+    for (int l = 0; l < hierarchy.num_levels(); ++l) {
+        EXPECT_EQ(hierarchy.level(l).num_cells(), 96 >> l);
+        EXPECT_DOUBLE_EQ(hierarchy.level(l).xmax(), 2.0);
+    }
+    EXPECT_EQ(MeshHierarchy(Mesh1D{0.0, 1.0, 96}, 2).num_levels(), 2);
+    EXPECT_EQ(MeshHierarchy(Mesh1D{0.0, 1.0, 100}, 10, 20).num_levels(), 3);  // 100, 50, 25
+}
+
+TEST(MeshHierarchyTest, RestrictionConservesIntegral) {
+    const int n_coarse = 8;
+    auto fine = make_array(2 * n_coarse);
+    auto coarse = make_array(n_coarse);
+    double fine_total = 0.0;
+    for (int i = 0; i < 2 * n_coarse; ++i) {
+        auto& U = fine[static_cast<std::size_t>(Mesh1D::num_ghosts + i)];
+        U = State{1.0 + std::sin(i), std::cos(3.0 * i), 2.0 + 0.1 * i * i};
+        fine_total += U.E;
+    }
+
+    restrict_average(std::span<const State>(fine), std::span<State>(coarse), n_coarse);
+
+    double coarse_total = 0.0;
+    for (int I = 0; I < n_coarse; ++I) {
+        coarse_total += coarse[static_cast<std::size_t>(Mesh1D::num_ghosts + I)].E;
+    }
+    EXPECT_NEAR(2.0 * coarse_total, fine_total, 1e-12);
+    EXPECT_DOUBLE_EQ(coarse[2].rho, 0.5 * (fine[2].rho + fine[3].rho));
+}
+
+TEST(MeshHierarchyTest, ProlongationIsConservativeAndLimited) {
+    const int n_coarse = 10;
+    auto delta = make_array(n_coarse);
+    for (int I = 0; I < n_coarse; ++I) {
+        const double x = I;
+        // Linear in rho, a step in rho_u, a peak in E
+        delta[static_cast<std::size_t>(Mesh1D::num_ghosts + I)] = State{x, I < 5 ? 0.0 : 1.0, I == 4 ? 1.0 : 0.0};
+    }
+    auto fine = make_array(2 * n_coarse);
+
+    prolong_limited_add(std::span<const State>(delta), std::span<State>(fine), n_coarse);
+
+    for (int I = 0; I < n_coarse; ++I) {
+        const auto& a = fine[static_cast<std::size_t>(Mesh1D::num_ghosts + 2 * I)];
+        const auto& b = fine[static_cast<std::size_t>(Mesh1D::num_ghosts + 2 * I + 1)];
+        const auto& d = delta[static_cast<std::size_t>(Mesh1D::num_ghosts + I)];
+        for (std::size_t k = 0; k < 3; ++k) {
+            EXPECT_NEAR(0.5 * (a[k] + b[k]), d[k], 1e-15) << "cell " << I << ", component " << k;
+            EXPECT_GE(std::min(a[k], b[k]), -1e-15) << "cell " << I << ", component " << k;
+            EXPECT_LE(std::max(a[k], b[k]), (k == 0) ? 9.0 : 1.0) << "cell " << I << ", component " << k;
+        }
+        // Linear data is reproduced away from the ends; steps and peaks get no slope
+        if (I > 0 && I < n_coarse - 1) {
+            EXPECT_DOUBLE_EQ(a.rho, I - 0.25);
+            EXPECT_DOUBLE_EQ(b.rho, I + 0.25);
+        }
+        EXPECT_DOUBLE_EQ(a.rho_u, b.rho_u);
+        EXPECT_DOUBLE_EQ(a.E, b.E);
+    }
+}
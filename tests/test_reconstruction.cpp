@@ -5,6 +5,9 @@
 
 #include <gtest/gtest.h>
 #include "euler1d/reconstruction/muscl.hpp"
+#include "euler1d/reconstruction/positivity.hpp"
+#include <cmath>
+#include <vector>
 
 using namespace euler1d;
 
@@ -71,3 +74,44 @@ TEST(ReconstructionTest, LimiterVariantWorks) {
     EXPECT_TRUE(std::isfinite(W_L.rho));
     EXPECT_TRUE(std::isfinite(W_R.rho));
 }
+
+TEST(ReconstructionTest, PositivityScalingPullsFaceTowardsCell) {
+    const PrimitiveVars cell{0.1, 0.0, 0.01};
+    PrimitiveVars face{0.3, 1.0, -0.01};
+
+    EXPECT_TRUE(scale_to_positive(face, cell));
+    EXPECT_TRUE(is_positive(face));
+    EXPECT_GT(face.rho, cell.rho);  // Same direction as the original slope
+    EXPECT_GT(face.u, 0.0);
+
+    // Admissible faces are left alone
+    PrimitiveVars admissible{0.3, 1.0, 0.02};
+    EXPECT_FALSE(scale_to_positive(admissible, cell));
+    EXPECT_DOUBLE_EQ(admissible.p, 0.02);
+}
+
+TEST(ReconstructionTest, CellSlopesMatchFaceSlopes) {
+    // Smooth region, extrema, a jump and a flat stretch
+    PrimitiveArray W;
+    for (int i = 0; i < 24; ++i) {
+        const double x = 0.25 * i;
+        W.push_back({1.0 + 0.5 * std::sin(x) + (i > 12 ? 1.0 : 0.0), std::cos(2.0 * x), i < 6 ? 1.0 : 1.0 + 0.1 * x});
+    }
+    PrimitiveArray dW(W.size());
+
+    const std::vector<LimiterVariant> limiters = {
+        NoLimiter{}, MinmodLimiter{}, VanLeerLimiter{}, SuperbeeLimiter{}, MCLimiter{}
+    };
+    for (const auto& limiter : limiters) {
+        MUSCLReconstruction::limit_slopes(std::span<const PrimitiveVars>(W), dW, limiter);
+        for (int i = 1; i + 2 < static_cast<int>(W.size()); ++i) {
+            const auto [W_L, W_R] = MUSCLReconstruction::reconstruct(std::span<const PrimitiveVars>(W), i, limiter);
+            const auto [C_L, C_R] = MUSCLReconstruction::cell_states(std::span<const PrimitiveVars>(W),
+                                                                     std::span<const PrimitiveVars>(dW), i);
+            for (std::size_t k = 0; k < PrimitiveVars::size(); ++k) {
+                EXPECT_NEAR(C_L[k], W_L[k], 1e-12);
+                EXPECT_NEAR(C_R[k], W_R[k], 1e-12);
+            }
+        }
+    }
+}
@@ -8,12 +8,33 @@
 #include "euler1d/solver/solver.hpp"
 #include <filesystem>
 #include <cmath>
+#include <csignal>
+#include <limits>
+#include <memory>
+#include <stdexcept>
 
 using namespace euler1d;
 
 class SolverIntegrationTest : public ::testing::Test {
 protected:
     std::filesystem::path data_dir{"data"};
+
+    /// Toro test 2 with |u| = 5: Superbee slopes overshoot into the near vacuum
+    Config double_rarefaction_config(bool positivity) const {
+        auto config = parse_config(data_dir / "test_case1.toml");
+        config.mesh.num_cells = 200;
+        config.time.final_time = 0.15;
+        config.time.cfl = 0.5;
+        config.numerics.order = 2;
+        config.numerics.flux = FluxScheme::HLLC;
+        config.numerics.limiter = Limiter::Superbee;
+        config.numerics.positivity = positivity;
+        config.initial_condition.regions = {
+            Region{0.0, 0.5, 1.0, -5.0, 0.4, {}},
+            Region{0.5, 1.0, 1.0, 5.0, 0.4, {}}
+        };
+        return config;
+    }
 };
 
 TEST_F(SolverIntegrationTest, SodShockTubeRuns) {
@@ -88,3 +109,750 @@ TEST_F(SolverIntegrationTest, ShockEntropyWaveRuns) {
     Solver solver(config);
     EXPECT_NO_THROW(solver.run());
 }
+
+TEST_F(SolverIntegrationTest, TiledMatchesUntiled) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.time.final_time = 0.05;
+    config.numerics.order = 2;
+    config.boundary.left = BoundaryType::Reflective;
+
+    Solver reference(config);
+    reference.run();
+
+    // Tile width that does not divide the cell count, so the last tile is partial
+    config.execution.tile_cells = 23;
+    Solver tiled(config);
+    tiled.run();
+
+    const auto& U_ref = reference.solution();
+    const auto& U_tiled = tiled.solution();
+    ASSERT_EQ(U_ref.size(), U_tiled.size());
+    for (std::size_t i = 0; i < U_ref.size(); ++i) {
+        EXPECT_DOUBLE_EQ(U_tiled[i].rho, U_ref[i].rho) << "cell " << i;
+        EXPECT_DOUBLE_EQ(U_tiled[i].rho_u, U_ref[i].rho_u) << "cell " << i;
+        EXPECT_DOUBLE_EQ(U_tiled[i].E, U_ref[i].E) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, CellSlopesMatchFaceSlopes) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.time.final_time = 0.1;
+    config.numerics.order = 2;
+    config.numerics.limiter = Limiter::MC;
+
+    config.numerics.slopes = Slopes::Face;
+    Solver reference(config);
+    reference.run();
+
+    // Tiled, so the tile workspace carries its own slope buffer
+    config.numerics.slopes = Slopes::Cell;
+    config.execution.tile_cells = 23;
+    Solver cell(config);
+    cell.run();
+
+    const auto& U_ref = reference.solution();
+    const auto& U_cell = cell.solution();
+    ASSERT_EQ(U_ref.size(), U_cell.size());
+    for (std::size_t i = 0; i < U_ref.size(); ++i) {
+        EXPECT_NEAR(U_cell[i].rho, U_ref[i].rho, 1e-10) << "cell " << i;
+        EXPECT_NEAR(U_cell[i].rho_u, U_ref[i].rho_u, 1e-10) << "cell " << i;
+        EXPECT_NEAR(U_cell[i].E, U_ref[i].E, 1e-10) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, MUSCLHancockTracksSSPRK3) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 400;
+    config.time.final_time = 0.15;
+    config.numerics.flux = FluxScheme::HLLC;
+
+    config.numerics.order = 2;
+    Solver reference(config);
+    reference.run();
+    config.numerics.order = 1;
+    Solver first_order(config);
+    first_order.run();
+
+    // MUSCL-Hancock implies MUSCL reconstruction whatever numerics.order says
+    config.time.integrator = TimeIntegrator::MUSCLHancock;
+    Solver hancock(config);
+    hancock.run();
+    config.execution.tile_cells = 37;
+    Solver tiled(config);
+    tiled.run();
+
+    const auto l1_distance = [&](const Solver& solver) {
+        double sum = 0.0;
+        for (int i = reference.mesh().first_interior(); i <= reference.mesh().last_interior(); ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            sum += std::abs(solver.solution()[k].rho - reference.solution()[k].rho) * reference.mesh().dx();
+        }
+        return sum;
+    };
+    EXPECT_LT(l1_distance(hancock), 2e-3);
+    EXPECT_LT(l1_distance(hancock), 0.5 * l1_distance(first_order));
+
+    for (std::size_t i = 0; i < hancock.solution().size(); ++i) {
+        EXPECT_DOUBLE_EQ(tiled.solution()[i].rho, hancock.solution()[i].rho) << "cell " << i;
+        EXPECT_DOUBLE_EQ(tiled.solution()[i].E, hancock.solution()[i].E) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, ADERConvergesAtThirdOrder) {
+    // Density sine advected once around a periodic box: rho = 1 + 0.2 sin(2 pi x), u = p = 1
+    const auto l1_error = [&](int num_cells, TimeIntegrator integrator, int tile_cells) {
+        auto config = parse_config(data_dir / "test_case1.toml");
+        config.mesh.num_cells = num_cells;
+        config.boundary.left = config.boundary.right = BoundaryType::Periodic;
+        config.numerics.order = 2;
+        config.numerics.flux = FluxScheme::HLLC;
+        config.time.integrator = integrator;
+        config.time.cfl = 0.4;
+        config.execution.tile_cells = tile_cells;
+
+        const double dx = 1.0 / num_cells;
+        const double two_pi = 2.0 * std::acos(-1.0);
+        const auto rho_average = [&](int i) {
+            return 1.0 + 0.2 * (std::cos(two_pi * i * dx) - std::cos(two_pi * (i + 1) * dx)) / (two_pi * dx);
+        };
+        Solver solver(config);
+        const IdealGas eos{config.eos.gamma};
+        for (int i = 0; i < num_cells; ++i) {
+            solver.interior()[static_cast<std::size_t>(i)] = eos.to_conservative(PrimitiveVars{rho_average(i), 1.0, 1.0});
+        }
+        solver.advance_to(1.0);
+
+        double sum = 0.0;
+        for (int i = 0; i < num_cells; ++i) {
+            sum += std::abs(solver.interior()[static_cast<std::size_t>(i)].rho - rho_average(i)) * dx;
+        }
+        return sum;
+    };
+
+    const double coarse = l1_error(64, TimeIntegrator::ADER, 0);
+    const double fine = l1_error(128, TimeIntegrator::ADER, 0);
+    EXPECT_GT(std::log2(coarse / fine), 2.7);
+    EXPECT_LT(fine, 0.1 * l1_error(128, TimeIntegrator::SSPRK3, 0));
+    EXPECT_DOUBLE_EQ(l1_error(128, TimeIntegrator::ADER, 29), fine);
+}
+
+TEST_F(SolverIntegrationTest, RoeEntropyFixAvoidsExpansionShock) {
+    // Toro test 1: the left rarefaction is transonic at x = 0.3. Without the
+    // entropy fix, first-order Roe leaves a density jump of about 0.2 there.
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.numerics.flux = FluxScheme::Roe;
+
+    Solver solver(config);
+    solver.run();
+
+    const auto W = solver.to_primitive();
+    for (int i = solver.mesh().first_interior(); i < solver.mesh().last_interior(); ++i) {
+        if (solver.mesh().x(i) > 0.2 && solver.mesh().x(i) < 0.4) {
+            const auto k = static_cast<std::size_t>(i);
+            EXPECT_LT(std::abs(W[k + 1].rho - W[k].rho), 0.05) << "cell " << i;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, KurganovTadmorRunsWithMUSCLAndBothIntegrators) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 400;
+    config.numerics.order = 2;
+
+    const auto run = [&](FluxScheme flux, TimeIntegrator integrator) {
+        config.numerics.flux = flux;
+        config.time.integrator = integrator;
+        auto solver = std::make_unique<Solver>(config);
+        solver->run();
+        return solver;
+    };
+    const auto hllc = run(FluxScheme::HLLC, TimeIntegrator::SSPRK3);
+    const auto llf = run(FluxScheme::LLF, TimeIntegrator::SSPRK3);
+    const auto kt = run(FluxScheme::KurganovTadmor, TimeIntegrator::SSPRK3);
+    const auto kt_euler = run(FluxScheme::KurganovTadmor, TimeIntegrator::ExplicitEuler);
+
+    const auto l1_distance = [&](const Solver& a, const Solver& b) {
+        double sum = 0.0;
+        for (int i = a.mesh().first_interior(); i <= a.mesh().last_interior(); ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            sum += std::abs(a.solution()[k].rho - b.solution()[k].rho) * a.mesh().dx();
+        }
+        return sum;
+    };
+    // The one-sided speeds make KT less diffusive than LLF
+    EXPECT_LT(l1_distance(*kt, *hllc), 0.5 * l1_distance(*llf, *hllc));
+    EXPECT_LT(l1_distance(*kt_euler, *kt), 5e-3);
+    for (const auto& U : kt_euler->interior()) {
+        EXPECT_GT(U.rho, 0.0);
+        EXPECT_TRUE(std::isfinite(U.E));
+    }
+}
+
+TEST_F(SolverIntegrationTest, HybridFluxKeepsConfiguredFluxAtDiscontinuities) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 400;
+    config.numerics.order = 2;
+
+    const auto run = [&](FluxScheme flux, bool hybrid) {
+        config.numerics.flux = flux;
+        config.numerics.hybrid_flux = hybrid;
+        auto solver = std::make_unique<Solver>(config);
+        solver->run();
+        return solver;
+    };
+    const auto l1_distance = [](const Solver& a, const Solver& b) {
+        double sum = 0.0;
+        for (int i = a.mesh().first_interior(); i <= a.mesh().last_interior(); ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            sum += std::abs(a.solution()[k].rho - b.solution()[k].rho) * a.mesh().dx();
+        }
+        return sum;
+    };
+    const auto hllc = run(FluxScheme::HLLC, false);
+    const auto llf = run(FluxScheme::LLF, false);
+    const auto hybrid = run(FluxScheme::HLLC, true);
+
+    // Few faces are flagged, yet the contact and shock stay HLLC-sharp
+    const auto counts = hybrid->hybrid_face_counts();
+    EXPECT_GT(counts.sharp_faces, 0);
+    EXPECT_LT(counts.sharp_faces, counts.smooth_faces / 10);
+    EXPECT_LT(l1_distance(*hybrid, *hllc), 0.2 * l1_distance(*llf, *hllc));
+    EXPECT_EQ(hllc->hybrid_face_counts().sharp_faces, 0);
+
+    // First order, Roe: a sensor that flags every face with any jump leaves
+    // LLF only the uniform faces, where both fluxes are F(U) up to round-off
+    config.numerics.order = 1;
+    config.numerics.sensor_threshold = 1e-9;
+    const auto roe = run(FluxScheme::Roe, false);
+    const auto roe_hybrid = run(FluxScheme::Roe, true);
+    EXPECT_GT(roe_hybrid->hybrid_face_counts().smooth_faces, 0);
+    EXPECT_LT(l1_distance(*roe_hybrid, *roe), 1e-10);
+}
+
+TEST_F(SolverIntegrationTest, ActiveRegionsMatchFullSweep) {
+    // Sod with walls: the waves start from one face, then reflect off both ends
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 400;
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    config.boundary.left = BoundaryType::Reflective;
+    config.boundary.right = BoundaryType::Reflective;
+
+    for (const Real t : {Real{0.1}, Real{0.6}}) {
+        Solver full(config);
+        config.execution.active_regions = true;
+        Solver active(config);
+        config.execution.active_regions = false;
+        full.advance_to(t);
+        active.advance_to(t);
+
+        ASSERT_EQ(active.steps(), full.steps());
+        for (std::size_t i = 0; i < full.solution().size(); ++i) {
+            EXPECT_NEAR(active.solution()[i].rho, full.solution()[i].rho, 1e-10) << "t = " << t << ", cell " << i;
+            EXPECT_NEAR(active.solution()[i].rho_u, full.solution()[i].rho_u, 1e-10) << "t = " << t << ", cell " << i;
+            EXPECT_NEAR(active.solution()[i].E, full.solution()[i].E, 1e-10) << "t = " << t << ", cell " << i;
+        }
+
+        const auto updates = active.cell_update_counts();
+        EXPECT_EQ(updates.updated + updates.skipped, static_cast<std::int64_t>(active.steps()) * 400);
+        EXPECT_EQ(full.cell_update_counts().skipped, 0);
+        if (t < 0.2) {
+            // Before the waves reach the walls most of the tube is quiescent
+            EXPECT_GT(updates.skipped, updates.updated);
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, ExpandingWindowMatchesFullDomain) {
+    // Sod in a tube ten times longer than the waves travel
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.xmin = -4.5;
+    config.mesh.xmax = 5.5;
+    config.mesh.num_cells = 2000;
+    config.initial_condition.regions.front().x_left = -4.5;
+    config.initial_condition.regions.back().x_right = 5.5;
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+
+    Solver full(config);
+    config.mesh.expand = true;
+    Solver window(config);
+    full.advance_to(0.2);
+    window.advance_to(0.2);
+
+    ASSERT_EQ(window.steps(), full.steps());
+    const auto stats = window.window_stats();
+    EXPECT_GT(stats.extensions, 0);
+    EXPECT_LT(stats.reallocations, stats.extensions);  // Some extensions grow into the headroom
+    EXPECT_LT(stats.peak_cells, 2000 / 4);
+    EXPECT_EQ(window.mesh().num_cells(), stats.peak_cells);
+
+    window.fit_window_to_domain();
+    ASSERT_EQ(window.solution().size(), full.solution().size());
+    for (std::size_t i = 0; i < full.solution().size(); ++i) {
+        EXPECT_NEAR(window.solution()[i].rho, full.solution()[i].rho, 1e-12) << "cell " << i;
+        EXPECT_NEAR(window.solution()[i].rho_u, full.solution()[i].rho_u, 1e-12) << "cell " << i;
+        EXPECT_NEAR(window.solution()[i].E, full.solution()[i].E, 1e-12) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, ExpandingWindowChecksConfigsBuiltInCode) {
+    // The window is only grown on a single rank and between open edges
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.expand = true;
+    auto threaded = config;
+    threaded.execution.threads = 2;
+    EXPECT_THROW(Solver{threaded}, ConfigError);
+    auto reflective = config;
+    reflective.boundary.right = BoundaryType::Reflective;
+    EXPECT_THROW(Solver{reflective}, ConfigError);
+    EXPECT_NO_THROW(Solver{config});
+}
+
+TEST_F(SolverIntegrationTest, ReducedPrecisionTracksDouble) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.time.final_time = 0.05;
+
+    BasicSolver<double> reference(config);
+    reference.run();
+    BasicSolver<float> single(config);
+    single.run();
+    BasicSolver<float, double> mixed(config);
+    mixed.run();
+
+    const auto& U_ref = reference.solution();
+    ASSERT_EQ(single.solution().size(), U_ref.size());
+    ASSERT_EQ(mixed.solution().size(), U_ref.size());
+    for (int i = reference.mesh().first_interior(); i <= reference.mesh().last_interior(); ++i) {
+        const auto idx = static_cast<std::size_t>(i);
+        EXPECT_NEAR(single.solution()[idx].rho, U_ref[idx].rho, 1e-3) << "cell " << i;
+        EXPECT_NEAR(mixed.solution()[idx].rho, U_ref[idx].rho, 1e-3) << "cell " << i;
+    }
+
+    // Mixed mode accumulates in double, so its mass total stays at least as close as pure float
+    const double mass_ref = reference.conserved_totals().rho;
+    EXPECT_LE(std::abs(mixed.conserved_totals().rho - mass_ref),
+              std::abs(single.conserved_totals().rho - mass_ref) + 1e-6);
+}
+
+TEST_F(SolverIntegrationTest, DecomposedMatchesSerial) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 203;
+    config.time.final_time = 0.05;
+    config.numerics.order = 2;
+
+    // Wall on the left, and a periodic case where the subdomains form a ring
+    for (const auto bc : {BoundaryType::Reflective, BoundaryType::Periodic}) {
+        config.boundary.left = bc;
+        config.boundary.right = (bc == BoundaryType::Periodic) ? bc : BoundaryType::Transmissive;
+        config.execution.threads = 1;
+        Solver reference(config);
+        reference.run();
+
+        config.execution.threads = 4;
+        Solver decomposed(config);
+        decomposed.run();
+
+        EXPECT_EQ(decomposed.steps(), reference.steps());
+        const auto& U_ref = reference.solution();
+        const auto& U_dec = decomposed.solution();
+        for (int i = reference.mesh().first_interior(); i <= reference.mesh().last_interior(); ++i) {
+            const auto idx = static_cast<std::size_t>(i);
+            EXPECT_DOUBLE_EQ(U_dec[idx].rho, U_ref[idx].rho) << "cell " << i;
+            EXPECT_DOUBLE_EQ(U_dec[idx].rho_u, U_ref[idx].rho_u) << "cell " << i;
+            EXPECT_DOUBLE_EQ(U_dec[idx].E, U_ref[idx].E) << "cell " << i;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, ProcessRanksMatchSerial) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 150;
+    config.time.final_time = 0.05;
+    config.numerics.order = 2;
+    config.boundary.left = BoundaryType::Periodic;
+    config.boundary.right = BoundaryType::Periodic;
+
+    Solver reference(config);
+    reference.run();
+
+    config.execution.processes = 3;
+    Solver decomposed(config);
+    decomposed.run();
+
+    EXPECT_EQ(decomposed.steps(), reference.steps());
+    EXPECT_DOUBLE_EQ(decomposed.time(), reference.time());
+    const auto& U_ref = reference.solution();
+    const auto& U_dec = decomposed.solution();
+    for (int i = reference.mesh().first_interior(); i <= reference.mesh().last_interior(); ++i) {
+        const auto idx = static_cast<std::size_t>(i);
+        EXPECT_DOUBLE_EQ(U_dec[idx].rho, U_ref[idx].rho) << "cell " << i;
+        EXPECT_DOUBLE_EQ(U_dec[idx].rho_u, U_ref[idx].rho_u) << "cell " << i;
+        EXPECT_DOUBLE_EQ(U_dec[idx].E, U_ref[idx].E) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, FailingRankReleasesItsNeighbours) {
+    // Rank 1 fails before publishing its wave speed, which ranks 0 and 2 wait for
+    const auto march = [](std::span<HaloMailbox<Real>> mailboxes, int rank, auto&& fail) {
+        MailboxCommunicator<Real> comm(mailboxes, {}, rank);
+        if (rank == 1) {
+            fail();
+        }
+        static_cast<void>(comm.allreduce_max(1.0));
+    };
+
+    std::vector<HaloMailbox<Real>> thread_mailboxes(3);
+    const std::span<HaloMailbox<Real>> threads(thread_mailboxes);
+    try {
+        run_thread_ranks(3, [&](int rank) { march(threads, rank, [] { throw std::runtime_error("rank 1 failed"); }); },
+                         [&] { abort_ranks(threads); });
+        ADD_FAILURE() << "Expected the failure of rank 1";
+    } catch (const std::runtime_error& error) {
+        EXPECT_STREQ(error.what(), "rank 1 failed");
+    }
+
+    // A process killed by a signal cannot raise the flag itself
+    SharedMemoryRegion memory(sizeof(HaloMailbox<Real>) * 3);
+    auto* mailbox_data = static_cast<HaloMailbox<Real>*>(memory.data());
+    std::uninitialized_value_construct_n(mailbox_data, 3);
+    const std::span<HaloMailbox<Real>> processes(mailbox_data, 3);
+    EXPECT_THROW(run_process_ranks(3, [&](int rank) { march(processes, rank, [] { std::raise(SIGKILL); }); },
+                                   [&] { abort_ranks(processes); }),
+                 std::runtime_error);
+    std::destroy(processes.begin(), processes.end());
+}
+
+TEST_F(SolverIntegrationTest, PositivityGuardKeepsDoubleRarefactionPhysical) {
+    Solver solver(double_rarefaction_config(true));
+    solver.run();
+
+    EXPECT_GT(solver.positivity_corrections().fallback_faces, 0);
+    const auto W = solver.to_primitive();
+    for (int i = solver.mesh().first_interior(); i <= solver.mesh().last_interior(); ++i) {
+        EXPECT_GT(W[static_cast<std::size_t>(i)].rho, 0.0) << "Negative density at cell " << i;
+        EXPECT_GT(W[static_cast<std::size_t>(i)].p, 0.0) << "Negative pressure at cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, WatchdogRollsBackNonPhysicalSteps) {
+    // Without the positivity guard this case produces NaNs at CFL 0.5
+    const auto config = double_rarefaction_config(false);
+    for (const int threads : {1, 3}) {
+        auto decomposed = config;
+        decomposed.execution.threads = threads;
+        Solver solver(decomposed);
+        solver.run();
+
+        EXPECT_DOUBLE_EQ(solver.time(), config.time.final_time);
+        const auto W = solver.to_primitive();
+        for (int i = solver.mesh().first_interior(); i <= solver.mesh().last_interior(); ++i) {
+            const auto& W_i = W[static_cast<std::size_t>(i)];
+            EXPECT_TRUE(std::isfinite(W_i.rho) && std::isfinite(W_i.u) && std::isfinite(W_i.p)) << "cell " << i;
+            EXPECT_GT(W_i.rho, 0.0) << "Negative density at cell " << i;
+            EXPECT_GT(W_i.p, 0.0) << "Negative pressure at cell " << i;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, WatchdogRollsBackAcrossWindowGrowth) {
+    // At CFL 0.7 a failure follows a checkpoint taken before the window grew
+    auto config = double_rarefaction_config(false);
+    config.time.cfl = 0.7;
+    Solver full(config);
+    full.run();
+    config.mesh.expand = true;
+    Solver window(config);
+    window.run();
+
+    ASSERT_EQ(window.steps(), full.steps());
+    EXPECT_GT(window.window_stats().extensions, 0);
+    ASSERT_EQ(window.solution().size(), full.solution().size());
+    for (std::size_t i = 0; i < full.solution().size(); ++i) {
+        EXPECT_NEAR(window.solution()[i].rho, full.solution()[i].rho, 1e-12) << "cell " << i;
+        EXPECT_NEAR(window.solution()[i].E, full.solution()[i].E, 1e-12) << "cell " << i;
+    }
+}
+
+TEST_F(SolverIntegrationTest, WatchdogThrowsWhenRetriesExhausted) {
+    auto config = double_rarefaction_config(false);
+    config.time.max_retries = 0;
+    Solver solver(config);
+    EXPECT_THROW(solver.run(), std::runtime_error);
+
+    // The last healthy solution is kept
+    for (const auto& u : solver.solution()) {
+        EXPECT_TRUE(std::isfinite(u.rho) && std::isfinite(u.rho_u) && std::isfinite(u.E));
+    }
+}
+
+TEST_F(SolverIntegrationTest, PassiveScalarsAdvectWithContact) {
+    if constexpr (num_scalars == 0) {
+        GTEST_SKIP() << "Species transport needs a build with EULER1D_NUM_SCALARS > 0";
+    }
+
+    // Sod tube with species 1 on the left of the diaphragm and the last species on the right
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.time.final_time = 0.2;
+    config.numerics.order = 2;
+    config.numerics.flux = FluxScheme::HLLC;
+    auto& regions = config.initial_condition.regions;
+    regions = {
+        Region{0.0, 0.5, 1.0, 0.0, 1.0, {}},
+        Region{0.5, 1.0, 0.125, 0.0, 0.1, {}}
+    };
+    regions[0].scalars.assign(num_scalars, 0.0);
+    regions[1].scalars.assign(num_scalars, 0.0);
+    regions[0].scalars.front() = 1.0;
+    regions[1].scalars.back() += 1.0;
+
+    Solver solver(config);
+    const auto initial_totals = solver.conserved_totals();
+    solver.run();
+    const auto final_totals = solver.conserved_totals();
+
+    // No flow through the boundaries: each species mass is conserved
+    for (std::size_t k = 3; k < num_components; ++k) {
+        EXPECT_NEAR(final_totals[k], initial_totals[k], 1e-12) << "component " << k;
+    }
+
+    // Mass fractions stay bounded and the interface sits at the contact (x ~ 0.69)
+    const auto W = solver.to_primitive();
+    for (int i = solver.mesh().first_interior(); i <= solver.mesh().last_interior(); ++i) {
+        const auto& W_i = W[static_cast<std::size_t>(i)];
+        for (std::size_t k = 3; k < num_components; ++k) {
+            EXPECT_GE(W_i[k], -1e-12) << "cell " << i;
+            EXPECT_LE(W_i[k], 1.0 + 1e-12) << "cell " << i;
+        }
+        if (solver.mesh().x(i) < 0.6) {
+            EXPECT_NEAR(W_i[3], 1.0, 1e-6) << "cell " << i;
+        } else if (solver.mesh().x(i) > 0.8) {
+            EXPECT_NEAR(W_i[3], 0.0, 1e-6) << "cell " << i;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, GravityAcceleratesUniformGas) {
+    // Periodic uniform gas: the fluxes cancel and only the source acts
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 50;
+    config.time.final_time = 0.1;
+    config.boundary = BoundaryConfig{BoundaryType::Periodic, BoundaryType::Periodic};
+    config.initial_condition.regions = {Region{0.0, 1.0, 1.0, 0.0, 1.0, {}}};
+    config.source.type = SourceType::Gravity;
+    config.source.gravity = -2.0;
+
+    for (const auto coupling : {SourceCoupling::Explicit, SourceCoupling::Strang}) {
+        for (const auto integrator : {TimeIntegrator::ExplicitEuler, TimeIntegrator::SSPRK3}) {
+            config.source.coupling = coupling;
+            config.time.integrator = integrator;
+            Solver solver(config);
+            solver.run();
+            for (const auto& U : solver.interior()) {
+                EXPECT_NEAR(U.rho_u / U.rho, -2.0 * 0.1, 1e-12);
+            }
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, SplitSourceMatchesAcrossExecutionModes) {
+    // Spherical blast: the source depends on the cell position
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 120;
+    config.time.final_time = 0.05;
+    config.numerics.order = 2;
+    config.boundary.left = BoundaryType::Reflective;
+    config.initial_condition.regions = {
+        Region{0.0, 0.3, 1.0, 0.0, 10.0, {}},
+        Region{0.3, 1.0, 1.0, 0.0, 0.1, {}}
+    };
+    config.source.type = SourceType::Geometric;
+    config.source.area = {0.0, 0.0, 1.0};
+    config.source.coupling = SourceCoupling::Strang;
+
+    Solver reference(config);
+    reference.run();
+
+    config.execution.tile_cells = 23;
+    Solver tiled(config);
+    tiled.run();
+
+    config.execution.tile_cells = 0;
+    config.execution.threads = 3;
+    Solver decomposed(config);
+    decomposed.run();
+
+    // Tiles and subdomains split the source loop differently between its
+    // vectorised body and scalar remainder, whose exp may differ in the last
+    // ulp. The modes therefore agree to a few ulp of the state, grown over
+    // the steps, rather than bitwise.
+    const Real tolerance = 64 * std::numeric_limits<Real>::epsilon();
+    const auto& U_ref = reference.solution();
+    for (const Solver* solver : {&tiled, &decomposed}) {
+        const auto& U = solver->solution();
+        for (int i = reference.mesh().first_interior(); i <= reference.mesh().last_interior(); ++i) {
+            const auto k = static_cast<std::size_t>(i);
+            const Real momentum_scale = std::sqrt(U_ref[k].rho * U_ref[k].E);
+            EXPECT_GT(U[k].rho, 0.0) << "cell " << i;
+            EXPECT_NEAR(U[k].rho, U_ref[k].rho, tolerance * U_ref[k].rho) << "cell " << i;
+            EXPECT_NEAR(U[k].rho_u, U_ref[k].rho_u, tolerance * momentum_scale) << "cell " << i;
+            EXPECT_NEAR(U[k].E, U_ref[k].E, tolerance * U_ref[k].E) << "cell " << i;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, ImplicitSodTracksExplicitSolution) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.time.final_time = 0.1;
+
+    Solver reference(config);
+    reference.run();
+
+    // Five times the explicit stability limit
+    config.time.cfl = 5.0;
+    for (const auto integrator : {TimeIntegrator::BackwardEuler, TimeIntegrator::BDF2}) {
+        config.time.integrator = integrator;
+        Solver solver(config);
+        solver.run();
+
+        EXPECT_LT(solver.steps(), reference.steps() / 4);
+        EXPECT_DOUBLE_EQ(solver.time(), reference.time());
+        const auto W = solver.to_primitive();
+        for (int i = solver.mesh().first_interior(); i <= solver.mesh().last_interior(); ++i) {
+            EXPECT_GT(W[static_cast<std::size_t>(i)].rho, 0.0) << "cell " << i;
+            EXPECT_GT(W[static_cast<std::size_t>(i)].p, 0.0) << "cell " << i;
+        }
+        double l1 = 0.0;
+        for (std::size_t i = 0; i < solver.interior().size(); ++i) {
+            l1 += std::abs(solver.interior()[i].rho - reference.interior()[i].rho) * solver.mesh().dx();
+        }
+        EXPECT_LT(l1, 0.02);
+    }
+}
+
+TEST_F(SolverIntegrationTest, CyclicReductionMatchesThomas) {
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 150;
+    config.time.final_time = 0.05;
+    config.time.cfl = 10.0;
+    config.time.integrator = TimeIntegrator::BDF2;
+    config.boundary.left = BoundaryType::Reflective;
+
+    Solver thomas(config);
+    thomas.run();
+
+    config.time.linear_solver = LinearSolver::PCR;
+    config.execution.threads = 3;
+    Solver pcr(config);
+    pcr.run();
+
+    EXPECT_EQ(pcr.steps(), thomas.steps());
+    for (std::size_t i = 0; i < thomas.interior().size(); ++i) {
+        EXPECT_NEAR(pcr.interior()[i].rho, thomas.interior()[i].rho, 1e-12) << "cell " << i;
+        EXPECT_NEAR(pcr.interior()[i].E, thomas.interior()[i].E, 1e-12) << "cell " << i;
+    }
+}
+
+namespace {
+
+/// Mach 2 shock at rest at x = 0.5, with a density bump that the post-shock flow carries out
+Config standing_shock_config() {
+    const double u_left = 2.0 * std::sqrt(1.4);
+    const double density_ratio = 2.4 * 4.0 / (0.4 * 4.0 + 2.0);  // (g+1)M^2 / ((g-1)M^2 + 2)
+    const double p_right = 1.0 + 2.8 / 2.4 * 3.0;                 // 1 + 2g/(g+1) (M^2 - 1)
+    auto config = parse_config("data/test_case1.toml");
+    config.mesh.num_cells = 200;
+    config.initial_condition.regions = {
+        Region{0.0, 0.5, 1.0, u_left, 1.0, {}},
+        Region{0.5, 1.0, density_ratio, u_left / density_ratio, p_right, {}}
+    };
+    config.steady.enabled = true;
+    config.steady.tolerance = 1e-6;
+    return config;
+}
+
+}  // namespace
+
+TEST_F(SolverIntegrationTest, SteadyResidualIsRhsOfFirstStage) {
+    // Covers both places the residual is summed: flux differences alone, and with an unsplit source
+    auto config = parse_config(data_dir / "test_case1.toml");
+    config.mesh.num_cells = 100;
+    config.numerics.order = 2;
+    config.time.integrator = TimeIntegrator::ExplicitEuler;
+    config.steady.enabled = true;
+    config.steady.max_iterations = 1;
+
+    for (const auto source : {SourceType::None, SourceType::Geometric}) {
+        config.source.type = source;
+        config.source.area = {1.0, 2.0};
+        Solver solver(config);
+        const std::vector<ConservativeVars> U_old(solver.interior().begin(), solver.interior().end());
+        const Real dt = solver.compute_dt();
+        const auto result = solver.solve_steady();
+        EXPECT_EQ(result.iterations, 1);
+        EXPECT_FALSE(result.converged);
+
+        // Forward Euler: U_new = U_old + dt * dU
+        BasicConservativeVars<double> residual_sq;
+        for (std::size_t i = 0; i < U_old.size(); ++i) {
+            accumulate_squares(residual_sq, precision_cast<double>((solver.interior()[i] - U_old[i]) / dt));
+        }
+        for (std::size_t k = 0; k < residual_sq.size(); ++k) {
+            EXPECT_NEAR(result.residual[k], std::sqrt(residual_sq[k] * solver.mesh().dx()),
+                        1e-9 * result.residual[k]) << "component " << k;
+        }
+    }
+}
+
+TEST_F(SolverIntegrationTest, SteadyShockConvergesFasterWithLocalTimeStepping) {
+    auto config = standing_shock_config();
+    Solver global(config);
+    const auto global_result = global.solve_steady();
+
+    config.steady.local_time_stepping = true;
+    Solver local(config);
+    const auto local_result = local.solve_steady();
+
+    // Behind the shock |u| + c is 30% lower, so cells there take longer local steps
+    ASSERT_TRUE(global_result.converged);
+    ASSERT_TRUE(local_result.converged);
+    EXPECT_LE(local_result.relative_residual, config.steady.tolerance);
+    EXPECT_LT(local_result.iterations, global_result.iterations * 4 / 5);
+
+    // Same steady state away from the shock: the upstream state and the Rankine-Hugoniot state behind it
+    for (const Solver* solver : {&global, &local}) {
+        EXPECT_NEAR(solver->interior().front().rho, 1.0, 1e-6);
+        EXPECT_NEAR(solver->interior().back().rho, 2.4 * 4.0 / 3.6, 1e-3);
+    }
+
+    // Implicit steps far beyond the explicit limit converge in a few dozen iterations
+    config.steady.local_time_stepping = false;
+    config.time.integrator = TimeIntegrator::BackwardEuler;
+    config.time.cfl = 100.0;
+    Solver implicit(config);
+    const auto implicit_result = implicit.solve_steady();
+    EXPECT_TRUE(implicit_result.converged);
+    EXPECT_LT(implicit_result.iterations, 50);
+}
+
+TEST_F(SolverIntegrationTest, MultigridAcceleratesSteadyShock) {
+    auto config = standing_shock_config();
+    Solver single(config);
+    const auto single_result = single.solve_steady();
+
+    config.steady.multigrid_levels = 3;
+    Solver multigrid(config);
+    const auto multigrid_result = multigrid.solve_steady();
+
+    ASSERT_TRUE(single_result.converged);
+    ASSERT_TRUE(multigrid_result.converged);
+    EXPECT_LT(multigrid_result.iterations, single_result.iterations / 4);
+    EXPECT_NEAR(multigrid.interior().front().rho, 1.0, 1e-6);
+    EXPECT_NEAR(multigrid.interior().back().rho, 2.4 * 4.0 / 3.6, 1e-3);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file test_source.cpp
+ * @brief Tests for source terms and their split integrators
+ */
+
+#include <gtest/gtest.h>
+#include "euler1d/config/parser.hpp"
+#include "euler1d/solver/factory.hpp"
+#include <cmath>
+
+using namespace euler1d;
+
+namespace {
+
+/// Conservative state with one passive scalar, whatever the build
+using State4 = BasicConservativeVars<Real, 4>;
+
+State4 make_state(Real rho, Real u, Real p, Real phi, const IdealGas& eos) {
+    return eos.to_conservative(BasicPrimitiveVars<Real, 4>{rho, u, p, {phi}});
+}
+
+/// (integrate(U, dt) - U) / dt, which tends to S(U) as dt -> 0
+template <typename Source>
+State4 split_rate(const Source& source, const State4& U, Real dt, const IdealGas& eos) {
+    return (source.integrate(U, 0, dt, eos) - U) / dt;
+}
+
+}  // namespace
+
+TEST(SourceTest, SplitIntegratorsAreConsistentWithRate) {
+    const IdealGas eos{1.4};
+    const State4 U = make_state(1.2, 0.7, 2.5, 0.6, eos);
+    const Real dt = 1e-7;
+
+    const BasicGeometricSource<Real> geometric{{2.0 / 0.3}};
+    const BasicGravitySource<Real> gravity{-9.81};
+    const BasicReactionSource<Real> reaction{5.0, 1.5, 3.0};
+
+    const auto check = [&](const auto& source, const char* name) {
+        const auto S = source.rate(U, 0, eos);
+        const auto S_split = split_rate(source, U, dt, eos);
+        for (std::size_t k = 0; k < S.size(); ++k) {
+            EXPECT_NEAR(S_split[k], S[k], 1e-5 * (1.0 + std::abs(S[k]))) << name << " component " << k;
+        }
+    };
+    check(geometric, "geometric");
+    check(gravity, "gravity");
+    check(reaction, "reaction");
+}
+
+TEST(SourceTest, GeometricSplitStepIsIsentropic) {
+    const IdealGas eos{1.4};
+    const State4 U = make_state(1.0, 2.0, 1.0, 0.25, eos);
+
+    // A long step of a strong expansion (a*u*dt = 4) keeps the state physical
+    const BasicGeometricSource<Real> spherical{{2.0}};
+    const auto U_new = spherical.integrate(U, 0, 1.0, eos);
+    const auto W = eos.to_primitive(U);
+    const auto W_new = eos.to_primitive(U_new);
+
+    EXPECT_NEAR(W_new.rho, std::exp(-4.0), 1e-14);
+    EXPECT_DOUBLE_EQ(W_new.u, W.u);
+    EXPECT_DOUBLE_EQ(W_new.phi[0], W.phi[0]);
+    EXPECT_GT(W_new.p, 0.0);
+    EXPECT_NEAR(W_new.p / std::pow(W_new.rho, 1.4), W.p / std::pow(W.rho, 1.4), 1e-12);
+}
+
+TEST(SourceTest, ReactionSplitStepStaysBoundedWhenStiff) {
+    const IdealGas eos{1.4};
+    const State4 U = make_state(1.0, 0.0, 1.0, 1.0, eos);
+    const Real q = 10.0;
+
+    // k*dt ~ 1e8: forward Euler would overshoot far below zero
+    const BasicReactionSource<Real> reaction{1e10, 5.0, q};
+    const auto U_new = reaction.integrate(U, 0, 1.0, eos);
+
+    EXPECT_GE(U_new.rho_phi[0], 0.0);
+    EXPECT_LT(U_new.rho_phi[0], 1e-6);
+    EXPECT_DOUBLE_EQ(U_new.rho, U.rho);
+    EXPECT_NEAR(U_new.E + q * U_new.rho_phi[0], U.E + q * U.rho_phi[0], 1e-12);
+}
+
+TEST(SourceTest, CreateSourceTabulatesAreaRatio) {
+    const Mesh1D mesh{0.0, 1.0, 10};
+    SourceConfig config;
+    config.type = SourceType::Geometric;
+    config.area = {0.0, 0.0, 1.0};  // Spherical: A'/A = 2/r
+
+    const auto source = create_source<double>(config, mesh);
+    const auto& ratio = std::get<BasicGeometricSource<double>>(source).area_ratio;
+    ASSERT_EQ(ratio.size(), static_cast<std::size_t>(mesh.total_cells()));
+    EXPECT_EQ(ratio.front(), 0.0);
+    for (int i = mesh.first_interior(); i <= mesh.last_interior(); ++i) {
+        EXPECT_NEAR(ratio[static_cast<std::size_t>(i)], 2.0 / mesh.x(i), 1e-12) << "cell " << i;
+    }
+
+    // Cross-section that closes inside the domain
+    config.area = {0.5, -1.0};
+    EXPECT_THROW(create_source<double>(config, mesh), ConfigError);
+}
@@ -17,6 +17,25 @@ protected:
             dU[i] = ConservativeVars{-U[i].rho, -U[i].rho_u, -U[i].E};
         }
     }
+
+    // (alpha*I - J) x = b with J = -I, the exact Jacobian of decay_rhs
+    static void decay_solve(std::span<const ConservativeVars> /*U*/, Real alpha, std::span<ConservativeVars> b) {
+        for (auto& b_i : b) {
+            b_i = b_i / (alpha + Real{1});
+        }
+    }
+
+    /// Error at t = 1 of an implicit integrator with n_steps steps
+    template <typename Integrator>
+    static Real implicit_error(int n_steps) {
+        ConservativeArray U(1, ConservativeVars{1.0, 0.0, 0.0});
+        BasicStepHistory<Real> history;
+        for (int i = 0; i < n_steps; ++i) {
+            Integrator{}.advance(std::span(U), Real{1} / static_cast<Real>(n_steps), RhsFunction(decay_rhs),
+                                 BasicLinearSolveFunction<Real>(decay_solve), history);
+        }
+        return std::abs(U[0].rho - std::exp(Real{-1}));
+    }
 };
 
 TEST_F(TimeIntegratorTest, ExplicitEulerConverges) {
@@ -73,3 +92,29 @@ TEST_F(TimeIntegratorTest, MultipleVariables) {
         EXPECT_LT(u.E, 3.0);
     }
 }
+
+TEST_F(TimeIntegratorTest, BackwardEulerIsFirstOrder) {
+    const Real ratio = implicit_error<BackwardEuler>(50) / implicit_error<BackwardEuler>(100);
+    EXPECT_NEAR(ratio, 2.0, 0.1);
+}
+
+TEST_F(TimeIntegratorTest, BDF2IsSecondOrder) {
+    const Real ratio = implicit_error<BDF2>(50) / implicit_error<BDF2>(100);
+    EXPECT_NEAR(ratio, 4.0, 0.3);
+    EXPECT_LT(implicit_error<BDF2>(100), implicit_error<BackwardEuler>(100));
+}
+
+TEST_F(TimeIntegratorTest, ImplicitStepsAreStableForStiffDecay) {
+    // dt = 50 is far beyond the explicit limit of dt = 2
+    ConservativeArray U(1, ConservativeVars{1.0, 0.0, 0.0});
+    BasicStepHistory<Real> history;
+    TimeIntegratorVariant integrator = BDF2{};
+    for (int i = 0; i < 10; ++i) {
+        advance<Real, Real>(integrator, U, 50.0, decay_rhs, decay_solve, history);
+        EXPECT_LT(std::abs(U[0].rho), 1.0);
+    }
+
+    // The explicit-only overload refuses implicit integrators
+    EXPECT_TRUE(is_implicit(integrator));
+    EXPECT_THROW(advance(integrator, U, 0.01, decay_rhs), std::invalid_argument);
+}